@@ -0,0 +1,119 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bench_float.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: rmourey- <rmourey-@student.42madrid.com>   +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 12:35:38 by rmourey-          #+#    #+#             */
+/*   Updated: 2026/10/18 12:35:38 by rmourey-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../ft_printf_bonus.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define BENCH_COUNT 1000000
+#define BENCH_FMTS 6
+
+static const char *const	g_bench_fmts[BENCH_FMTS] = {"%g", "%.17g",
+	"%e", "%.3e", "%f", "%12.3f"};
+
+static double	bench_random(unsigned long long *state, long i)
+{
+	unsigned long long	bits;
+	double				v;
+
+	*state ^= *state << 13;
+	*state ^= *state >> 7;
+	*state ^= *state << 17;
+	bits = *state;
+	if (i % 3 == 1)
+		bits = (bits & 0x800fffffffffffffULL)
+			| ((unsigned long long)(1023 + (long)(bits % 61) - 30) << 52);
+	if (i % 3 == 2)
+		return ((double)(bits % 10000000) / 1000.0);
+	memcpy(&v, &bits, sizeof(v));
+	if (((bits >> 52) & 0x7ff) == 0x7ff)
+		return (1.0);
+	return (v);
+}
+
+static double	bench_now(void)
+{
+	struct timespec	ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (ts.tv_sec * 1e9 + ts.tv_nsec);
+}
+
+static double	bench_ft(const double *vals, const char *fmt, size_t *bytes)
+{
+	char	buf[512];
+	t_sink	out;
+	double	start;
+	long	i;
+
+	start = bench_now();
+	i = 0;
+	while (i < BENCH_COUNT)
+	{
+		ft_sink_mem(&out, buf, sizeof(buf));
+		*bytes += ft_printf_sink(&out, fmt, vals[i++]);
+	}
+	return ((bench_now() - start) / BENCH_COUNT);
+}
+
+static double	bench_libc(const double *vals, const char *fmt, size_t *bytes)
+{
+	char	buf[512];
+	double	start;
+	long	i;
+
+	start = bench_now();
+	i = 0;
+	while (i < BENCH_COUNT)
+		*bytes += snprintf(buf, sizeof(buf), fmt, vals[i++]);
+	return ((bench_now() - start) / BENCH_COUNT);
+}
+
+static void	bench_run(const double *vals)
+{
+	size_t	bytes[2];
+	double	ns[2];
+	int		i;
+
+	printf("%-8s %12s %12s %8s\n", "format", "ft ns/call", "libc ns/call",
+		"speedup");
+	i = -1;
+	while (++i < BENCH_FMTS)
+	{
+		bytes[0] = 0;
+		bytes[1] = 0;
+		ns[0] = bench_ft(vals, g_bench_fmts[i], &bytes[0]);
+		ns[1] = bench_libc(vals, g_bench_fmts[i], &bytes[1]);
+		printf("%-8s %12.1f %12.1f %7.2fx%s\n", g_bench_fmts[i], ns[0], ns[1],
+			ns[1] / ns[0], &" (output differs)"[17 * (bytes[0] == bytes[1])]);
+	}
+}
+
+int	main(void)
+{
+	double				*vals;
+	unsigned long long	state;
+	long				i;
+
+	vals = malloc(sizeof(*vals) * BENCH_COUNT);
+	if (!vals)
+		return (1);
+	state = 88172645463325252ULL;
+	i = -1;
+	while (++i < BENCH_COUNT)
+		vals[i] = bench_random(&state, i);
+	bench_run(vals);
+	free(vals);
+	return (0);
+}
@@ -0,0 +1,309 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bench_printf.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: rmourey- <rmourey-@student.42madrid.com>   +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 16:18:54 by rmourey-          #+#    #+#             */
+/*   Updated: 2026/10/18 16:18:54 by rmourey-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../ft_printf_bonus.h"
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/wait.h>
+
+#define BENCH_COUNT 50000
+#define BENCH_CASES 18
+#define BENCH_ROWS 5
+#define BENCH_VALS 64
+#define BENCH_SLOWER 1.15
+
+typedef struct s_case
+{
+	const char	*fmt;
+	char		kind;
+}	t_case;
+
+typedef struct s_bench
+{
+	int		who;
+	t_sink	sink;
+	char	buf[256];
+	int		ints[BENCH_VALS];
+}	t_bench;
+
+typedef struct s_result
+{
+	double	ns[2];
+	double	bytes[2];
+	double	sys[2];
+}	t_result;
+
+static const t_case			g_cases[BENCH_CASES] = {{"c=%c\n", 'i'},
+{"c=%-4c|\n", 'i'}, {"s=%s\n", 's'}, {"s=%24s\n", 's'},
+{"s=%-24.6s|\n", 's'}, {"p=%p\n", 'p'}, {"p=%20p\n", 'p'},
+{"d=%d\n", 'i'}, {"d=%+8d\n", 'i'}, {"d=% 08d\n", 'i'},
+{"d=%-10.5d|\n", 'i'}, {"i=%i\n", 'i'}, {"u=%u\n", 'i'},
+{"u=%12u\n", 'i'}, {"x=%x\n", 'i'}, {"x=%#010x\n", 'i'},
+{"X=%#X\n", 'i'}, {"pct=%%\n", 'i'}};
+
+static const char *const	g_rows[BENCH_ROWS] = {"memory", "null",
+	"null+buf", "pipe", "pipe+buf"};
+
+static const char *const	g_strs[4] = {"GET", "/api/v1/users/12345",
+	"a somewhat longer string that needs a fair amount of copying",
+	""};
+
+/* who: row * 2 + side; side 0 is ft_printf, side 1 glibc. Rows 1 and 3
+   write each call (ft_printf, dprintf); rows 2 and 4 buffer across calls
+   (ft_printf_sink on one fd sink, stdio printf). */
+static int	bench_int(t_bench *b, const char *fmt, int v)
+{
+	int	side;
+	int	row;
+
+	side = b->who % 2;
+	row = b->who / 2;
+	if (row == 0 && side == 0)
+		return (ft_snprintf(b->buf, sizeof(b->buf), fmt, v));
+	if (row == 0)
+		return (snprintf(b->buf, sizeof(b->buf), fmt, v));
+	if (row % 2 == 1 && side == 0)
+		return (ft_printf(fmt, v));
+	if (row % 2 == 1)
+		return (dprintf(1, fmt, v));
+	if (side == 0)
+		return (ft_printf_sink(&b->sink, fmt, v));
+	return (printf(fmt, v));
+}
+
+static int	bench_ptr(t_bench *b, const char *fmt, const void *v)
+{
+	int	side;
+	int	row;
+
+	side = b->who % 2;
+	row = b->who / 2;
+	if (row == 0 && side == 0)
+		return (ft_snprintf(b->buf, sizeof(b->buf), fmt, v));
+	if (row == 0)
+		return (snprintf(b->buf, sizeof(b->buf), fmt, v));
+	if (row % 2 == 1 && side == 0)
+		return (ft_printf(fmt, v));
+	if (row % 2 == 1)
+		return (dprintf(1, fmt, v));
+	if (side == 0)
+		return (ft_printf_sink(&b->sink, fmt, v));
+	return (printf(fmt, v));
+}
+
+/* Write syscalls made by this process so far, from /proc/self/io; -1
+   where the kernel does not account them. */
+static long	bench_syscw(void)
+{
+	char	buf[512];
+	char	*p;
+	int		fd;
+	ssize_t	n;
+
+	fd = open("/proc/self/io", O_RDONLY);
+	if (fd < 0)
+		return (-1);
+	n = read(fd, buf, sizeof(buf) - 1);
+	close(fd);
+	if (n <= 0)
+		return (-1);
+	buf[n] = '\0';
+	p = strstr(buf, "syscw:");
+	if (!p)
+		return (-1);
+	return (atol(p + 6));
+}
+
+static double	bench_now(void)
+{
+	struct timespec	ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (ts.tv_sec * 1e9 + ts.tv_nsec);
+}
+
+static void	bench_flush(t_bench *b)
+{
+	if (b->who == 4 || b->who == 8)
+		ft_sink_flush(&b->sink);
+	if (b->who == 5 || b->who == 9)
+		fflush(stdout);
+}
+
+/* Times one case for one side of one row; buffered rows include the
+   final flush. */
+static void	bench_side(t_bench *b, const t_case *c, t_result *r, int side)
+{
+	double	start;
+	long	sys;
+	long	i;
+	double	bytes;
+
+	ft_sink_fd(&b->sink, 1);
+	sys = bench_syscw();
+	bytes = 0;
+	start = bench_now();
+	i = -1;
+	while (++i < BENCH_COUNT)
+	{
+		if (c->kind == 's')
+			bytes += bench_ptr(b, c->fmt, g_strs[i % 4]);
+		else if (c->kind == 'p')
+			bytes += bench_ptr(b, c->fmt, (void *)(b->ints + i % 16));
+		else
+			bytes += bench_int(b, c->fmt, b->ints[i % BENCH_VALS]);
+	}
+	bench_flush(b);
+	r->ns[side] = (bench_now() - start) / BENCH_COUNT;
+	r->bytes[side] = bytes;
+	r->sys[side] = (double)(bench_syscw() - sys) / BENCH_COUNT;
+	if (sys < 0)
+		r->sys[side] = -1;
+}
+
+static void	bench_row(t_bench *b, int row, t_result *res)
+{
+	int	c;
+
+	c = -1;
+	while (++c < BENCH_CASES)
+	{
+		b->who = row * 2;
+		bench_side(b, &g_cases[c], &res[c * BENCH_ROWS + row], 0);
+		b->who = row * 2 + 1;
+		bench_side(b, &g_cases[c], &res[c * BENCH_ROWS + row], 1);
+	}
+}
+
+/* Rows 3 and 4 write into a pipe drained by a child process. */
+static void	bench_pipe(t_bench *b, t_result *res, int saved)
+{
+	int		fds[2];
+	char	sink[65536];
+	pid_t	pid;
+
+	if (pipe(fds) < 0)
+		return ;
+	pid = fork();
+	if (pid == 0)
+	{
+		close(fds[1]);
+		close(saved);
+		while (read(fds[0], sink, sizeof(sink)) > 0)
+			;
+		_exit(0);
+	}
+	close(fds[0]);
+	dup2(fds[1], 1);
+	close(fds[1]);
+	bench_row(b, 3, res);
+	bench_row(b, 4, res);
+	dup2(saved, 1);
+	waitpid(pid, NULL, 0);
+}
+
+static void	bench_all(t_bench *b, t_result *res)
+{
+	int	saved;
+	int	null;
+
+	bench_row(b, 0, res);
+	fflush(stdout);
+	saved = dup(1);
+	null = open("/dev/null", O_WRONLY);
+	if (saved < 0 || null < 0)
+		return ;
+	dup2(null, 1);
+	close(null);
+	bench_row(b, 1, res);
+	bench_row(b, 2, res);
+	bench_pipe(b, res, saved);
+	close(saved);
+}
+
+/* Baseline file: one "case row ns" line per result, ft_printf side. */
+static int	bench_baseline(const char *path, double *base)
+{
+	FILE	*f;
+	int		c;
+	int		row;
+	double	ns;
+
+	f = fopen(path, "r");
+	if (!f)
+		return (0);
+	while (fscanf(f, "%d %d %lf", &c, &row, &ns) == 3)
+		if (c >= 0 && c < BENCH_CASES && row >= 0 && row < BENCH_ROWS)
+			base[c * BENCH_ROWS + row] = ns;
+	fclose(f);
+	return (1);
+}
+
+static void	bench_save(const char *path, const t_result *res)
+{
+	FILE	*f;
+	int		k;
+
+	f = fopen(path, "w");
+	if (!f)
+		return ;
+	k = -1;
+	while (++k < BENCH_CASES * BENCH_ROWS)
+		fprintf(f, "%d %d %.1f\n", k / BENCH_ROWS, k % BENCH_ROWS,
+			res[k].ns[0]);
+	fclose(f);
+	printf("baseline written to %s\n", path);
+}
+
+static void	bench_line(const t_result *r, int k, double base)
+{
+	const char	*fmt;
+
+	fmt = g_cases[k / BENCH_ROWS].fmt;
+	printf("%-14.*s %-9s %8.1f %8.1f %6.2fx %8.1f %6.2f %6.2f",
+		(int)strlen(fmt) - 1, fmt, g_rows[k % BENCH_ROWS], r->ns[0],
+		r->ns[1], r->ns[1] / r->ns[0],
+		r->bytes[0] / (r->ns[0] * BENCH_COUNT) * 1e3, r->sys[0], r->sys[1]);
+	if (base > 0)
+		printf(" %+6.1f%%%s", (r->ns[0] / base - 1) * 100,
+			&"  SLOWER"[8 * (r->ns[0] <= base * BENCH_SLOWER)]);
+	printf("\n");
+}
+
+/* usage: bench_printf [baseline]; compares with the baseline file when
+   it exists and writes it otherwise. */
+int	main(int argc, char **argv)
+{
+	static t_result	res[BENCH_CASES * BENCH_ROWS];
+	static double	base[BENCH_CASES * BENCH_ROWS];
+	static t_bench	b;
+	int				have;
+	int				k;
+
+	srand(42);
+	k = -1;
+	while (++k < BENCH_VALS)
+		b.ints[k] = (rand() - RAND_MAX / 2) >> (k % 24);
+	have = argc > 1 && bench_baseline(argv[1], base);
+	bench_all(&b, res);
+	printf("%-14s %-9s %8s %8s %7s %8s %6s %6s%s\n", "format", "target",
+		"ft ns", "libc ns", "speed", "ft MB/s", "ft sys", "lc sys",
+		&" vs base"[8 * !have]);
+	k = -1;
+	while (++k < BENCH_CASES * BENCH_ROWS)
+		bench_line(&res[k], k, base[k]);
+	if (argc > 1 && !have)
+		bench_save(argv[1], res);
+	return (0);
+}
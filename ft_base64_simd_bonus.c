@@ -0,0 +1,88 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_base64_simd_bonus.c                             :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: rmourey- <rmourey-@student.42madrid.com>   +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 14:10:51 by rmourey-          #+#    #+#             */
+/*   Updated: 2026/10/18 14:10:51 by rmourey-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "ft_printf_bonus.h"
+
+#ifdef __x86_64__
+# include <tmmintrin.h>
+
+/* Spreads 12 input bytes into sixteen 6-bit indices, one per byte. */
+__attribute__((target("ssse3")))
+static __m128i	ft_b64_indices(__m128i in)
+{
+	__m128i	hi;
+	__m128i	lo;
+
+	in = _mm_shuffle_epi8(in, _mm_setr_epi8(1, 0, 2, 1, 4, 3, 5, 4,
+				7, 6, 8, 7, 10, 9, 11, 10));
+	hi = _mm_mulhi_epu16(_mm_and_si128(in, _mm_set1_epi32(0x0FC0FC00)),
+			_mm_set1_epi32(0x04000040));
+	lo = _mm_mullo_epi16(_mm_and_si128(in, _mm_set1_epi32(0x003F03F0)),
+			_mm_set1_epi32(0x01000010));
+	return (_mm_or_si128(hi, lo));
+}
+
+/* Maps indices to ASCII by adding a per-range offset picked with pshufb:
+   0-25 'A', 26-51 'a', 52-61 '0', 62 and 63 from the alphabet. */
+__attribute__((target("ssse3")))
+static __m128i	ft_b64_ascii(__m128i idx, const char *abc)
+{
+	__m128i	range;
+	__m128i	lut;
+
+	lut = _mm_setr_epi8('a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+			'0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+			abc[62] - 62, abc[63] - 63, 'A', 0, 0);
+	range = _mm_subs_epu8(idx, _mm_set1_epi8(51));
+	range = _mm_or_si128(range, _mm_and_si128(
+				_mm_cmpgt_epi8(_mm_set1_epi8(26), idx), _mm_set1_epi8(13)));
+	return (_mm_add_epi8(_mm_shuffle_epi8(lut, range), idx));
+}
+
+__attribute__((target("ssse3")))
+static size_t	ft_b64_ssse3(const unsigned char *p, size_t n, char *dst,
+					const char *abc)
+{
+	size_t	done;
+
+	done = 0;
+	while (n - done >= 16)
+	{
+		_mm_storeu_si128((__m128i *)dst, ft_b64_ascii(ft_b64_indices(
+					_mm_loadu_si128((const __m128i *)(p + done))), abc));
+		done += 12;
+		dst += 16;
+	}
+	return (done);
+}
+
+/* Encodes a prefix of p (a multiple of 12 bytes) and returns its length;
+   the caller finishes the rest with the scalar encoder. */
+size_t	ft_b64_block(const unsigned char *p, size_t n, char *dst,
+			const char *abc)
+{
+	if (n >= 16 && __builtin_cpu_supports("ssse3"))
+		return (ft_b64_ssse3(p, n, dst, abc));
+	return (0);
+}
+#else
+
+size_t	ft_b64_block(const unsigned char *p, size_t n, char *dst,
+			const char *abc)
+{
+	(void)p;
+	(void)n;
+	(void)dst;
+	(void)abc;
+	return (0);
+}
+#endif
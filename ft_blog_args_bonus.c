@@ -0,0 +1,129 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_blog_args_bonus.c                               :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: rmourey- <rmourey-@student.42madrid.com>   +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 15:16:31 by rmourey-          #+#    #+#             */
+/*   Updated: 2026/10/18 19:16:12 by rmourey-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "ft_printf_bonus.h"
+
+/* Strings and buffers are copied into the record, since the caller may
+   reuse them as soon as ft_blog returns: a 32-bit length (FT_BLOG_NULL
+   for a null pointer, whatever the length argument), padding up to the
+   unit size, then the data. Strings keep their terminator so the decoder
+   can hand them to the handlers in place. */
+static int	ft_blog_var(t_blog *log, t_arg_kind kind, const t_arg *arg)
+{
+	uint32_t	n;
+	size_t		unit;
+	wchar_t		nul;
+
+	if (arg->n > FT_BLOG_NULL - 1)
+		return (0);
+	n = (uint32_t)arg->n;
+	if (!arg->p)
+		n = FT_BLOG_NULL;
+	unit = 1;
+	if (kind == ARG_WSTR)
+		unit = sizeof(wchar_t);
+	nul = 0;
+	if (!ft_blog_put(log, &n, 4)
+		|| !ft_blog_put(log, &nul, (unit - log->len % unit) % unit))
+		return (0);
+	if (n == FT_BLOG_NULL)
+		return (1);
+	return (ft_blog_put(log, arg->p, arg->n * unit)
+		&& ft_blog_put(log, &nul, unit * (kind != ARG_BYTES)));
+}
+
+/* Only the part of a string the conversion can print is recorded. With
+   '#', %ls precision counts columns, not characters, so it is kept
+   whole. */
+static int	ft_blog_arg(t_blog *log, t_fmt *spec, t_arg_kind kind,
+				va_list *args)
+{
+	t_arg	arg;
+	size_t	max;
+
+	ft_fetch_arg(spec, kind, args, &arg);
+	if (kind < ARG_STR)
+		return (ft_blog_put_fixed(log, kind, &arg, ft_arg_size(spec, kind)));
+	if (kind != ARG_BYTES)
+		arg.n = 0;
+	max = FT_BLOG_NULL - 1;
+	if (spec->precision >= 0 && !(kind == ARG_WSTR && spec->hash))
+		max = spec->precision;
+	if (kind == ARG_STR && arg.p)
+		arg.n = ft_strnlen(arg.p, max);
+	else if (kind == ARG_WSTR && arg.p)
+	{
+		while (arg.n < max && ((const wchar_t *)arg.p)[arg.n])
+			arg.n++;
+	}
+	return (ft_blog_var(log, kind, &arg));
+}
+
+/* What recording needs from each conversion of a format, so that later
+   messages skip the parser. Returns the number of arguments, -1 past
+   FT_BLOG_ARGS. */
+int	ft_blog_sig(const char *format, t_blog_sig *sig)
+{
+	int		i;
+	int		n;
+	t_fmt	spec;
+
+	i = 0;
+	n = 0;
+	while (format[i])
+	{
+		if (format[i] == '%' && ft_parse_format(format, &i, &spec)
+			&& spec.specifier != '%')
+		{
+			if (n == FT_BLOG_ARGS)
+				return (-1);
+			sig[n].kind = ft_arg_kind(&spec);
+			sig[n].length = spec.length;
+			sig[n].hash = spec.hash != 0;
+			sig[n].precision = spec.precision;
+			n++;
+		}
+		if (format[i])
+			i++;
+	}
+	return (n);
+}
+
+/* Serializes the arguments the format consumes, in order, from its
+   cached signature, or by parsing formats too long to have one.
+   Returns 0 when the log runs out of room. */
+int	ft_blog_args(t_blog *log, int id, const char *format, va_list *args)
+{
+	int			i;
+	t_fmt		spec;
+	t_blog_sig	*sig;
+
+	i = 0;
+	while (i < log->nargs[id])
+	{
+		sig = &log->sigs[id][i++];
+		spec.length = sig->length;
+		spec.hash = sig->hash;
+		spec.precision = sig->precision;
+		if (!ft_blog_arg(log, &spec, sig->kind, args))
+			return (0);
+	}
+	while (log->nargs[id] < 0 && format[i])
+	{
+		if (format[i] == '%' && ft_parse_format(format, &i, &spec)
+			&& !ft_blog_arg(log, &spec, ft_arg_kind(&spec), args))
+			return (0);
+		if (format[i])
+			i++;
+	}
+	return (1);
+}
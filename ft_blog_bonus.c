@@ -0,0 +1,102 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_blog_bonus.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: rmourey- <rmourey-@student.42madrid.com>   +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 15:13:14 by rmourey-          #+#    #+#             */
+/*   Updated: 2026/10/18 19:29:20 by rmourey-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "ft_printf_bonus.h"
+
+/* buf is caller memory; align it for wchar_t (malloc or static storage
+   is) so %ls records decode in place. */
+void	ft_blog_init(t_blog *log, void *buf, size_t cap)
+{
+	log->buf = buf;
+	log->cap = cap;
+	log->len = 0;
+	log->dropped = 0;
+	ft_bzero(log->fmts, sizeof(log->fmts));
+}
+
+/* Writes the text of format in a format record for slot and parses its
+   argument signature. A later record for the same slot replaces it, in
+   the log and in the decoder. */
+static int	ft_blog_format_record(t_blog *log, const char *format,
+				size_t slot)
+{
+	size_t	n;
+
+	n = ft_strlen(format) + 1;
+	if (n > FT_BLOG_NULL - 1 || FT_BLOG_HEAD + n > log->cap - log->len)
+		return (-1);
+	ft_blog_head(log, 'F', slot, n);
+	log->text[slot] = log->len;
+	ft_blog_put(log, format, n);
+	log->fmts[slot] = format;
+	log->nargs[slot] = ft_blog_sig(format, log->sigs[slot]);
+	return ((int)slot);
+}
+
+/* Formats are identified by address, hashed into a fixed open-addressed
+   table. The first record that uses a format carries its text under the
+   slot number; later messages only name the slot and reuse the argument
+   signature parsed then. A hit is checked against the recorded text, so
+   a buffer reused for another format gets a new record. */
+static int	ft_blog_format_id(t_blog *log, const char *format)
+{
+	size_t	slot;
+	size_t	probes;
+
+	slot = (((unsigned long long)(uintptr_t)format * 0x9E3779B97F4A7C15ULL)
+			>> 40) % FT_BLOG_FMTS;
+	probes = 0;
+	while (probes++ < FT_BLOG_FMTS && log->fmts[slot]
+		&& log->fmts[slot] != format)
+		slot = (slot + 1) % FT_BLOG_FMTS;
+	if (log->fmts[slot] == format && !ft_strncmp(format,
+			(const char *)log->buf + log->text[slot], FT_BLOG_NULL))
+		return ((int)slot);
+	if (log->fmts[slot] && log->fmts[slot] != format)
+		return (-1);
+	return (ft_blog_format_record(log, format, slot));
+}
+
+/* Records one message without formatting it. A message that does not
+   fit is dropped whole and counted; returns the bytes appended or -1. */
+int	ft_vblog(t_blog *log, const char *format, va_list *args)
+{
+	size_t		start;
+	int			id;
+	uint32_t	n;
+
+	id = -1;
+	if (format)
+		id = ft_blog_format_id(log, format);
+	start = log->len;
+	if (id >= 0 && ft_blog_head(log, 'M', id, 0)
+		&& ft_blog_args(log, id, format, args))
+	{
+		n = (uint32_t)(log->len - start - FT_BLOG_HEAD);
+		ft_memcpy(log->buf + start + 3, &n, 4);
+		return ((int)(log->len - start));
+	}
+	log->len = start;
+	log->dropped++;
+	return (-1);
+}
+
+int	ft_blog(t_blog *log, const char *format, ...)
+{
+	va_list	args;
+	int		count;
+
+	va_start(args, format);
+	count = ft_vblog(log, format, &args);
+	va_end(args);
+	return (count);
+}
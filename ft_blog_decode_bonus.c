@@ -0,0 +1,125 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_blog_decode_bonus.c                             :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: rmourey- <rmourey-@student.42madrid.com>   +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 15:23:05 by rmourey-          #+#    #+#             */
+/*   Updated: 2026/10/18 19:19:29 by rmourey-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "ft_printf_bonus.h"
+
+/* Mirrors ft_blog_var: strings and buffers are used in place. A string
+   whose recorded terminator is missing makes the record invalid, so a
+   corrupted log cannot make the handlers read past it. */
+static int	ft_blog_load(t_cursor *rd, t_fmt *spec, t_arg *arg)
+{
+	t_arg_kind			kind;
+	const unsigned char	*p;
+	uint32_t			n;
+	size_t				unit;
+
+	kind = ft_arg_kind(spec);
+	if (kind < ARG_STR)
+		return (ft_blog_take_fixed(rd, spec, kind, arg));
+	p = ft_blog_take(rd, 4);
+	if (!p)
+		return (0);
+	ft_memcpy(&n, p, 4);
+	unit = 1 + (sizeof(wchar_t) - 1) * (kind == ARG_WSTR);
+	arg->p = NULL;
+	arg->n = n * (n != FT_BLOG_NULL);
+	if (!ft_blog_take(rd, (unit - rd->pos % unit) % unit))
+		return (0);
+	if (n == FT_BLOG_NULL)
+		return (1);
+	p = ft_blog_take(rd, (n + (kind != ARG_BYTES)) * unit);
+	arg->p = p;
+	if (!p || kind == ARG_BYTES)
+		return (p != NULL);
+	return ((kind == ARG_WSTR && !((const wchar_t *)p)[n])
+		|| (kind == ARG_STR && !p[n]));
+}
+
+/* The ft_vprintf_sink loop, with arguments read from the record. Stops
+   at the first argument the record does not hold. */
+static int	ft_blog_message(t_sink *out, t_cursor *rd, const char *format)
+{
+	int		i;
+	int		start;
+	int		count;
+	t_fmt	spec;
+	t_arg	arg;
+
+	i = 0;
+	count = 0;
+	while (format[i])
+	{
+		start = i;
+		while (format[i] && format[i] != '%')
+			i++;
+		count += ft_putnstr_count(out, format + start, i - start);
+		if (format[i] && ft_parse_format(format, &i, &spec))
+		{
+			if (!ft_blog_load(rd, &spec, &arg))
+				return (count);
+			count += ft_format_arg(out, &spec, &arg);
+		}
+		if (format[i])
+			i++;
+	}
+	return (count);
+}
+
+/* Decodes one record. Returns the bytes it rendered, -1 at the end of
+   the data or on a truncated record. */
+static int	ft_blog_record(t_sink *out, const char **fmts, t_cursor *rd)
+{
+	const unsigned char	*head;
+	unsigned short		id;
+	uint32_t			n;
+	t_cursor			body;
+
+	head = ft_blog_take(rd, FT_BLOG_HEAD);
+	if (!head)
+		return (-1);
+	ft_memcpy(&id, head + 1, 2);
+	ft_memcpy(&n, head + 3, 4);
+	body.buf = rd->buf;
+	body.pos = rd->pos;
+	body.end = rd->pos + n;
+	if (id >= FT_BLOG_FMTS || !ft_blog_take(rd, n))
+		return (-1);
+	if (head[0] == 'F' && n && !body.buf[body.end - 1])
+		fmts[id] = (const char *)body.buf + body.pos;
+	else if (head[0] == 'M' && fmts[id])
+		return (ft_blog_message(out, &body, fmts[id]));
+	return (0);
+}
+
+/* Renders every message of a buffer written by ft_blog, as ft_printf
+   would have at the time of the call. data must be aligned for wchar_t.
+   Returns the number of bytes written to out. */
+int	ft_blog_decode(t_sink *out, const void *data, size_t len)
+{
+	const char	*fmts[FT_BLOG_FMTS];
+	t_cursor	rd;
+	int			count;
+	int			n;
+
+	ft_bzero(fmts, sizeof(fmts));
+	rd.buf = data;
+	rd.pos = 0;
+	rd.end = len;
+	count = 0;
+	n = ft_blog_record(out, fmts, &rd);
+	while (n >= 0)
+	{
+		count += n;
+		n = ft_blog_record(out, fmts, &rd);
+	}
+	return (count);
+}
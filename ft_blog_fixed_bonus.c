@@ -0,0 +1,93 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_blog_fixed_bonus.c                              :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: rmourey- <rmourey-@student.42madrid.com>   +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 19:03:04 by rmourey-          #+#    #+#             */
+/*   Updated: 2026/10/18 19:03:04 by rmourey-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "ft_printf_bonus.h"
+
+/* Fixed-size arguments, written and read back in the same layout:
+   integers at the width ft_arg_size gives them, a %T time as its 64-bit
+   seconds followed by its 32-bit nanoseconds. */
+int	ft_blog_put_fixed(t_blog *log, t_arg_kind kind, const t_arg *arg,
+		int size)
+{
+	int			i4;
+	long long	i8;
+
+	if (kind == ARG_DOUBLE)
+		return (ft_blog_put(log, &arg->d, size));
+	if (kind == ARG_PTR)
+		return (ft_blog_put(log, &arg->p, size));
+	i4 = (int)arg->i;
+	i8 = (long long)arg->i;
+	if (kind == ARG_TIME)
+	{
+		i4 = (int)arg->n;
+		return (ft_blog_put(log, &i8, sizeof(i8))
+			&& ft_blog_put(log, &i4, sizeof(i4)));
+	}
+	if (size == sizeof(int))
+		return (ft_blog_put(log, &i4, size));
+	if (size == sizeof(long long))
+		return (ft_blog_put(log, &i8, size));
+	return (ft_blog_put(log, &arg->i, size));
+}
+
+static void	ft_blog_take_int(const unsigned char *p, int size,
+				t_arg_kind kind, t_arg *arg)
+{
+	int			i4;
+	long long	i8;
+
+	if (size == sizeof(int))
+	{
+		ft_memcpy(&i4, p, size);
+		arg->i = i4;
+		if (kind == ARG_UNSIGNED)
+			arg->i = (unsigned int)i4;
+	}
+	else if (size == sizeof(long long))
+	{
+		ft_memcpy(&i8, p, size);
+		arg->i = i8;
+		if (kind == ARG_UNSIGNED)
+			arg->i = (t_wide)(unsigned long long)i8;
+	}
+	else
+		ft_memcpy(&arg->i, p, size);
+}
+
+int	ft_blog_take_fixed(t_cursor *rd, t_fmt *spec, t_arg_kind kind,
+		t_arg *arg)
+{
+	const unsigned char	*p;
+	int					size;
+	int					i4;
+	long long			i8;
+
+	size = ft_arg_size(spec, kind);
+	p = ft_blog_take(rd, size);
+	if (!p)
+		return (0);
+	if (kind == ARG_DOUBLE)
+		ft_memcpy(&arg->d, p, size);
+	else if (kind == ARG_PTR)
+		ft_memcpy(&arg->p, p, size);
+	else if (kind == ARG_TIME)
+	{
+		ft_memcpy(&i8, p, sizeof(i8));
+		ft_memcpy(&i4, p + sizeof(i8), sizeof(i4));
+		arg->i = i8;
+		arg->n = (unsigned int)i4;
+	}
+	else
+		ft_blog_take_int(p, size, kind, arg);
+	return (1);
+}
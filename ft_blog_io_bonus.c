@@ -0,0 +1,85 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_blog_io_bonus.c                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: rmourey- <rmourey-@student.42madrid.com>   +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 15:19:48 by rmourey-          #+#    #+#             */
+/*   Updated: 2026/10/18 19:35:54 by rmourey-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "ft_printf_bonus.h"
+
+/* Appends n bytes, or nothing and 0 when they do not fit. */
+int	ft_blog_put(t_blog *log, const void *p, size_t n)
+{
+	if (n > log->cap - log->len)
+		return (0);
+	ft_memcpy(log->buf + log->len, p, n);
+	log->len += n;
+	return (1);
+}
+
+/* Record header: tag, format slot, payload length, in host byte order. */
+int	ft_blog_head(t_blog *log, char tag, unsigned short id, uint32_t n)
+{
+	return (ft_blog_put(log, &tag, 1) && ft_blog_put(log, &id, 2)
+		&& ft_blog_put(log, &n, 4));
+}
+
+/* Returns the next n bytes and moves past them, NULL when the data ends
+   first. */
+const unsigned char	*ft_blog_take(t_cursor *cur, size_t n)
+{
+	const unsigned char	*p;
+
+	if (cur->pos > cur->end || n > cur->end - cur->pos)
+		return (NULL);
+	p = cur->buf + cur->pos;
+	cur->pos += n;
+	return (p);
+}
+
+static int	ft_blog_write(int fd, const unsigned char *p, size_t n)
+{
+	size_t	done;
+	ssize_t	w;
+
+	done = 0;
+	while (done < n)
+	{
+		w = write(fd, p + done, n - done);
+		if (w < 0)
+			return (0);
+		done += w;
+	}
+	return (1);
+}
+
+/* Writes the recorded bytes to fd and starts a fresh log in the same
+   buffer. Each flushed chunk carries its own format records and is padded
+   to a multiple of FT_BLOG_ALIGN bytes with a 'P' record the decoder
+   skips, so wide strings, aligned from the start of their chunk, stay
+   aligned and chunks decode independently or concatenated. */
+int	ft_blog_flush(t_blog *log, int fd)
+{
+	unsigned char	pad[FT_BLOG_HEAD + FT_BLOG_ALIGN];
+	size_t			total;
+	uint32_t		n;
+
+	total = (FT_BLOG_ALIGN - log->len % FT_BLOG_ALIGN) % FT_BLOG_ALIGN;
+	total += FT_BLOG_ALIGN * (total && total < FT_BLOG_HEAD);
+	ft_bzero(pad, sizeof(pad));
+	pad[0] = 'P';
+	n = (uint32_t)(total - FT_BLOG_HEAD * (total != 0));
+	ft_memcpy(pad + 3, &n, 4);
+	if (!ft_blog_write(fd, log->buf, log->len)
+		|| !ft_blog_write(fd, pad, total))
+		return (-1);
+	total += log->len;
+	log->len = 0;
+	ft_bzero(log->fmts, sizeof(log->fmts));
+	return ((int)total);
+}
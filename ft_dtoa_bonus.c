@@ -0,0 +1,40 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_dtoa_bonus.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: rmourey- <rmourey-@student.42madrid.com>   +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 12:25:47 by rmourey-          #+#    #+#             */
+/*   Updated: 2026/10/18 12:25:47 by rmourey-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "ft_printf_bonus.h"
+
+static int	ft_dec_target(t_dec *dec, char style, int prec)
+{
+	if (style == 'f')
+		return (dec->exp + 1 + prec);
+	return (prec + 1);
+}
+
+void	ft_dtoa(double v, t_dec *dec, char style, int prec)
+{
+	unsigned long long	bits;
+
+	ft_memcpy(&bits, &v, sizeof(bits));
+	bits &= ~(1ULL << 63);
+	dec->len = 0;
+	dec->exp = 0;
+	if (bits == 0)
+		return ;
+	if (bits >> 52)
+	{
+		ft_dtoa_shortest(bits, dec);
+		if (ft_dec_fast(dec, ft_dec_target(dec, style, prec)))
+			return ;
+	}
+	ft_dtoa_exact(bits, dec);
+	ft_dec_round(dec, ft_dec_target(dec, style, prec));
+}
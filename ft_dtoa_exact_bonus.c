@@ -0,0 +1,110 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_dtoa_exact_bonus.c                              :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: rmourey- <rmourey-@student.42madrid.com>   +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 12:22:30 by rmourey-          #+#    #+#             */
+/*   Updated: 2026/10/18 12:22:30 by rmourey-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "ft_printf_bonus.h"
+
+static int	ft_big_mul(unsigned int *limbs, int n, unsigned int mul)
+{
+	unsigned long long	carry;
+	int					i;
+
+	carry = 0;
+	i = 0;
+	while (i < n)
+	{
+		carry += (unsigned long long)limbs[i] * mul;
+		limbs[i++] = carry % 1000000000;
+		carry /= 1000000000;
+	}
+	while (carry)
+	{
+		limbs[n++] = carry % 1000000000;
+		carry /= 1000000000;
+	}
+	return (n);
+}
+
+static int	ft_big_digits(unsigned int *limbs, int n, char *out)
+{
+	unsigned int	v;
+	int				len;
+	int				i;
+
+	len = ft_declen(limbs[n - 1]);
+	ft_utoa_dec(limbs[--n], out + len);
+	while (n > 0)
+	{
+		v = limbs[--n];
+		i = 9;
+		while (i-- > 0)
+		{
+			out[len + i] = '0' + v % 10;
+			v /= 10;
+		}
+		len += 9;
+	}
+	return (len);
+}
+
+static int	ft_big_init(unsigned int *limbs, unsigned long long bits, int *e)
+{
+	unsigned long long	m;
+
+	m = bits & ((1ULL << 52) - 1);
+	*e = (int)((bits >> 52) & 0x7ff);
+	if (*e == 0)
+		*e = 1;
+	else
+		m |= 1ULL << 52;
+	*e -= 1075;
+	limbs[0] = m % 1000000000;
+	limbs[1] = m / 1000000000 % 1000000000;
+	limbs[2] = m / 1000000000000000000ULL;
+	return (1 + (m >= 1000000000) + (m >= 1000000000000000000ULL));
+}
+
+static int	ft_big_scale(unsigned int *limbs, int n, int e)
+{
+	unsigned int	mul;
+
+	while (e >= 31)
+	{
+		n = ft_big_mul(limbs, n, 1U << 31);
+		e -= 31;
+	}
+	if (e > 0)
+		n = ft_big_mul(limbs, n, 1U << e);
+	while (e <= -13)
+	{
+		n = ft_big_mul(limbs, n, 1220703125);
+		e += 13;
+	}
+	mul = 1;
+	while (e++ < 0)
+		mul *= 5;
+	return (ft_big_mul(limbs, n, mul));
+}
+
+void	ft_dtoa_exact(unsigned long long bits, t_dec *dec)
+{
+	unsigned int	limbs[FT_BIG_LIMBS];
+	int				e;
+	int				n;
+
+	n = ft_big_init(limbs, bits, &e);
+	n = ft_big_scale(limbs, n, e);
+	dec->len = ft_big_digits(limbs, n, dec->digits);
+	dec->exp = dec->len - 1;
+	if (e < 0)
+		dec->exp += e;
+	ft_dec_trim(dec, dec->len);
+}
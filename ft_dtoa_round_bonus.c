@@ -0,0 +1,79 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_dtoa_round_bonus.c                              :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: rmourey- <rmourey-@student.42madrid.com>   +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 12:19:13 by rmourey-          #+#    #+#             */
+/*   Updated: 2026/10/18 12:19:13 by rmourey-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "ft_printf_bonus.h"
+
+void	ft_dec_trim(t_dec *dec, int n)
+{
+	while (n > 0 && dec->digits[n - 1] == '0')
+		n--;
+	dec->len = n;
+	if (n == 0)
+		dec->exp = 0;
+}
+
+static void	ft_dec_carry(t_dec *dec, int n)
+{
+	while (n > 0 && dec->digits[n - 1] == '9')
+		n--;
+	if (n == 0)
+	{
+		dec->digits[0] = '1';
+		dec->len = 1;
+		dec->exp++;
+		return ;
+	}
+	dec->digits[n - 1]++;
+	dec->len = n;
+}
+
+static int	ft_dec_above_half(t_dec *dec, int n)
+{
+	int	i;
+
+	if (dec->digits[n] != '5')
+		return (dec->digits[n] > '5');
+	i = n + 1;
+	while (i < dec->len)
+		if (dec->digits[i++] != '0')
+			return (1);
+	return (n > 0 && (dec->digits[n - 1] - '0') % 2 == 1);
+}
+
+void	ft_dec_round(t_dec *dec, int n)
+{
+	if (n >= dec->len)
+		return ;
+	if (n < 0 || !ft_dec_above_half(dec, n))
+		ft_dec_trim(dec, n * (n > 0));
+	else if (n == 0)
+	{
+		dec->digits[0] = '1';
+		dec->len = 1;
+		dec->exp++;
+	}
+	else
+		ft_dec_carry(dec, n);
+}
+
+int	ft_dec_fast(t_dec *dec, int n)
+{
+	if (n >= dec->len)
+		return (n <= 15);
+	if (n < 1 || n > 14 || dec->digits[n] == '4' || dec->digits[n] == '5')
+		return (0);
+	if (dec->digits[n] > '5')
+		ft_dec_carry(dec, n);
+	else
+		ft_dec_trim(dec, n);
+	return (1);
+}
@@ -0,0 +1,77 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_escape_scan_bonus.c                             :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: rmourey- <rmourey-@student.42madrid.com>   +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 13:38:01 by rmourey-          #+#    #+#             */
+/*   Updated: 2026/10/18 17:57:24 by rmourey-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "ft_printf_bonus.h"
+
+int	ft_escape_byte(unsigned char c, int cstyle)
+{
+	return (c < 0x20 || c == '"' || c == '\\' || (cstyle && c == 0x7F));
+}
+
+#if FT_SSE2_SCAN
+# include <emmintrin.h>
+
+static int	ft_escape_block(const char *s, int cstyle)
+{
+	__m128i	v;
+	__m128i	hit;
+
+	v = _mm_load_si128((const __m128i *)s);
+	hit = _mm_or_si128(_mm_cmpeq_epi8(v, _mm_set1_epi8('"')),
+			_mm_cmpeq_epi8(v, _mm_set1_epi8('\\')));
+	hit = _mm_or_si128(hit, _mm_cmpeq_epi8(_mm_min_epu8(v,
+					_mm_set1_epi8(0x1F)), v));
+	if (cstyle)
+		hit = _mm_or_si128(hit, _mm_cmpeq_epi8(v, _mm_set1_epi8(0x7F)));
+	return (_mm_movemask_epi8(hit));
+}
+
+/* Length of the leading run of bytes that need no escaping (a NUL also
+   ends it), at most max. Aligned loads keep the scan inside the page. */
+size_t	ft_escape_span(const char *s, size_t max, int cstyle)
+{
+	size_t	i;
+	int		mask;
+
+	i = 0;
+	while (i < max && ((uintptr_t)(s + i) & 15))
+	{
+		if (ft_escape_byte(s[i], cstyle))
+			return (i);
+		i++;
+	}
+	while (i < max)
+	{
+		mask = ft_escape_block(s + i, cstyle);
+		if (mask)
+		{
+			i += __builtin_ctz(mask);
+			break ;
+		}
+		i += 16;
+	}
+	if (i > max)
+		return (max);
+	return (i);
+}
+#else
+
+size_t	ft_escape_span(const char *s, size_t max, int cstyle)
+{
+	size_t	i;
+
+	i = 0;
+	while (i < max && !ft_escape_byte(s[i], cstyle))
+		i++;
+	return (i);
+}
+#endif
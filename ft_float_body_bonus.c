@@ -0,0 +1,99 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_float_body_bonus.c                              :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: rmourey- <rmourey-@student.42madrid.com>   +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 12:29:04 by rmourey-          #+#    #+#             */
+/*   Updated: 2026/10/18 12:29:04 by rmourey-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "ft_printf_bonus.h"
+
+int	ft_float_flen(t_dec *dec, t_fmt *spec)
+{
+	int	ilen;
+
+	ilen = dec->exp + 1;
+	if (ilen < 1)
+		ilen = 1;
+	return (ilen + (spec->precision > 0 || spec->hash) + spec->precision);
+}
+
+int	ft_float_elen(t_dec *dec, t_fmt *spec)
+{
+	int	exp;
+
+	exp = dec->exp;
+	if (exp < 0)
+		exp = -exp;
+	if (exp < 10)
+		exp = 10;
+	return (3 + (spec->precision > 0 || spec->hash) + spec->precision
+		+ ft_declen(exp));
+}
+
+static int	ft_float_span(t_sink *out, t_dec *dec, int from, int n)
+{
+	int	count;
+	int	avail;
+
+	count = 0;
+	if (from < 0)
+	{
+		avail = -from;
+		if (avail > n)
+			avail = n;
+		count = ft_print_padding(out, avail, '0');
+		n -= avail;
+		from = 0;
+	}
+	avail = dec->len - from;
+	if (avail > n)
+		avail = n;
+	if (avail < 0)
+		avail = 0;
+	count += ft_putnstr_count(out, dec->digits + from, avail);
+	return (count + ft_print_padding(out, n - avail, '0'));
+}
+
+int	ft_float_fbody(t_sink *out, t_dec *dec, t_fmt *spec)
+{
+	int	count;
+
+	if (dec->exp < 0)
+		count = ft_putchar_count(out, '0');
+	else
+		count = ft_float_span(out, dec, 0, dec->exp + 1);
+	if (spec->precision > 0 || spec->hash)
+		count += ft_putchar_count(out, '.');
+	return (count + ft_float_span(out, dec, dec->exp + 1, spec->precision));
+}
+
+int	ft_float_ebody(t_sink *out, t_dec *dec, t_fmt *spec)
+{
+	char	exp[8];
+	int		count;
+	int		e;
+	int		len;
+
+	count = ft_float_span(out, dec, 0, 1);
+	if (spec->precision > 0 || spec->hash)
+		count += ft_putchar_count(out, '.');
+	count += ft_float_span(out, dec, 1, spec->precision);
+	exp[0] = 'e';
+	if (ft_toupper(spec->specifier) == spec->specifier)
+		exp[0] = 'E';
+	e = dec->exp;
+	exp[1] = '+';
+	if (e < 0)
+		exp[1] = '-';
+	if (e < 0)
+		e = -e;
+	len = 2 + (e >= 100);
+	exp[2] = '0';
+	ft_utoa_dec(e, exp + 2 + len);
+	return (count + ft_putnstr_count(out, exp, len + 2));
+}
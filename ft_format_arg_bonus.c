@@ -0,0 +1,57 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_format_arg_bonus.c                              :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: rmourey- <rmourey-@student.42madrid.com>   +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 13:57:43 by rmourey-          #+#    #+#             */
+/*   Updated: 2026/10/18 19:12:55 by rmourey-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "ft_printf_bonus.h"
+
+static int	ft_format_text(t_sink *out, t_fmt *spec, const t_arg *arg)
+{
+	if (spec->specifier == 'c' && spec->length == LEN_L)
+		return (ft_print_wchar(out, (wint_t)arg->i, spec));
+	if (spec->specifier == 'c')
+		return (ft_print_char(out, (char)arg->i, spec));
+	if (spec->specifier == 's' && spec->length == LEN_L)
+		return (ft_print_wstr(out, (const wchar_t *)arg->p, spec));
+	if (spec->specifier == 's')
+		return (ft_print_str(out, (char *)arg->p, spec));
+	if (spec->specifier == 'M')
+		return (ft_print_hexdump(out, arg->p, arg->n, spec));
+	if (spec->specifier == 'R')
+		return (ft_print_base64(out, arg->p, arg->n, spec));
+	if (spec->specifier == 'q')
+		return (ft_print_escaped(out, (const char *)arg->p, spec));
+	return (ft_print_char(out, '%', spec));
+}
+
+/* Renders one conversion from an argument already fetched, either from
+   a va_list or from a binary log record. */
+int	ft_format_arg(t_sink *out, t_fmt *spec, const t_arg *arg)
+{
+	if (ft_strchr("csqMR%", spec->specifier))
+		return (ft_format_text(out, spec, arg));
+	if (spec->specifier == 'p')
+		return (ft_print_ptr(out, (void *)arg->p, spec));
+	if (spec->specifier == 'T')
+		return (ft_print_time(out, (long long)arg->i, arg->n, spec));
+	if (spec->specifier == 'd' || spec->specifier == 'i')
+		return (ft_print_nbr(out, arg->i, spec));
+	if (spec->specifier == 'k')
+		return (ft_print_fixed(out, arg->i, spec));
+	if (spec->specifier == 'H')
+		return (ft_print_size(out, (t_uwide)arg->i, spec));
+	if (spec->specifier == 'N')
+		return (ft_print_duration(out, arg->i, spec));
+	if (ft_strchr("fFeEgGaA", spec->specifier))
+		return (ft_print_float(out, arg->d, spec));
+	if (ft_strchr("uxXobB", spec->specifier))
+		return (ft_print_unsigned(out, (t_uwide)arg->i, spec));
+	return (0);
+}
@@ -0,0 +1,120 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_format_array_bonus.c                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: rmourey- <rmourey-@student.42madrid.com>   +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 10:57:08 by rmourey-          #+#    #+#             */
+/*   Updated: 2026/10/18 19:26:03 by rmourey-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "ft_printf_bonus.h"
+
+/* Reads element i and narrows it as ft_read_signed and ft_read_unsigned
+   narrow an argument, so %hhd and %hu print what ft_printf would. The
+   other length modifiers are at least as wide as any element. */
+static t_wide	ft_array_at(const void *vals, size_t i, t_col *col)
+{
+	int		is_signed;
+	t_wide	v;
+
+	is_signed = (col->spec.specifier == 'd' || col->spec.specifier == 'i');
+	if (col->elem == ELEM_INT && is_signed)
+		v = ((const int *)vals)[i];
+	else if (col->elem == ELEM_INT || col->elem == ELEM_UINT)
+		v = ((const unsigned int *)vals)[i];
+	else if (col->elem == ELEM_I64 && is_signed)
+		v = ((const int64_t *)vals)[i];
+	else
+		v = (t_wide)((const uint64_t *)vals)[i];
+	if (col->spec.length == LEN_HH && is_signed)
+		return ((signed char)v);
+	if (col->spec.length == LEN_HH)
+		return ((unsigned char)v);
+	if (col->spec.length == LEN_H && is_signed)
+		return ((short)v);
+	if (col->spec.length == LEN_H)
+		return ((unsigned short)v);
+	return (v);
+}
+
+static void	ft_array_item(t_sink *out, t_wide v, size_t i, t_col *col)
+{
+	if (i > 0)
+		ft_putnstr_count(out, col->sep, col->seplen);
+	if (col->spec.specifier == 'd' || col->spec.specifier == 'i')
+		ft_print_nbr(out, v, &col->spec);
+	else
+		ft_print_unsigned(out, (t_uwide)v, &col->spec);
+}
+
+static int	ft_array_pair(t_sink *out, const void *vals, size_t i, t_col *col)
+{
+	t_wide			v[2];
+	unsigned int	mag[2];
+	char			digits[16];
+	int				k;
+
+	v[0] = ft_array_at(vals, i, col);
+	v[1] = ft_array_at(vals, i + 1, col);
+	if (v[0] <= -100000000 || v[0] >= 100000000
+		|| v[1] <= -100000000 || v[1] >= 100000000
+		|| (col->spec.specifier == 'u' && (v[0] < 0 || v[1] < 0)))
+		return (0);
+	mag[0] = (unsigned int)(v[0] * (1 - 2 * (v[0] < 0)));
+	mag[1] = (unsigned int)(v[1] * (1 - 2 * (v[1] < 0)));
+	ft_utoa_dec8x2(mag[0], mag[1], digits);
+	k = -1;
+	while (++k < 2)
+	{
+		if (i + k > 0)
+			ft_putnstr_count(out, col->sep, col->seplen);
+		if (v[k] < 0)
+			ft_putchar_count(out, '-');
+		ft_putnstr_count(out, digits + 8 * k + 8 - ft_declen(mag[k]),
+			ft_declen(mag[k]));
+	}
+	return (1);
+}
+
+size_t	ft_format_array(t_sink *out, const void *vals, size_t n, t_col *col)
+{
+	size_t	i;
+	size_t	start;
+
+	start = out->len;
+	i = 0;
+	while (i < n)
+	{
+		if (col->plain && i + 1 < n && ft_array_pair(out, vals, i, col))
+			i += 2;
+		else
+		{
+			ft_array_item(out, ft_array_at(vals, i, col), i, col);
+			i++;
+		}
+	}
+	return (out->len - start);
+}
+
+int	ft_col_init(t_col *col, const char *conv, const char *sep)
+{
+	int		i;
+	t_fmt	*sp;
+
+	i = 0;
+	sp = &col->spec;
+	if (conv[0] != '%' || !ft_parse_format(conv, &i, sp)
+		|| !ft_strchr("diuxXobB", sp->specifier) || conv[i + 1] != '\0')
+		return (0);
+	col->sep = sep;
+	col->seplen = ft_strlen(sep);
+	col->elem = ELEM_INT;
+	col->plain = (ft_strchr("diu", sp->specifier) && !sp->minus && !sp->zero
+			&& !sp->hash && !sp->space && !sp->plus && sp->width == 0
+			&& sp->precision < 0 && sp->length != LEN_HH
+			&& sp->length != LEN_H);
+	return (1);
+}
@@ -0,0 +1,53 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_format_arrays_bonus.c                           :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: rmourey- <rmourey-@student.42madrid.com>   +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 11:00:25 by rmourey-          #+#    #+#             */
+/*   Updated: 2026/10/18 11:00:25 by rmourey-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "ft_printf_bonus.h"
+
+size_t	ft_format_int_array(t_sink *out, const int *vals, size_t n, t_col *col)
+{
+	col->elem = ELEM_INT;
+	return (ft_format_array(out, vals, n, col));
+}
+
+size_t	ft_format_uint_array(t_sink *out, const unsigned int *vals, size_t n,
+			t_col *col)
+{
+	col->elem = ELEM_UINT;
+	return (ft_format_array(out, vals, n, col));
+}
+
+size_t	ft_format_i64_array(t_sink *out, const int64_t *vals, size_t n,
+			t_col *col)
+{
+	col->elem = ELEM_I64;
+	return (ft_format_array(out, vals, n, col));
+}
+
+size_t	ft_format_u64_array(t_sink *out, const uint64_t *vals, size_t n,
+			t_col *col)
+{
+	col->elem = ELEM_U64;
+	return (ft_format_array(out, vals, n, col));
+}
+
+size_t	ft_format_hex_array(t_sink *out, const uint64_t *vals, size_t n,
+			t_col *col)
+{
+	t_col	hex;
+
+	hex = *col;
+	if (hex.spec.specifier != 'X')
+		hex.spec.specifier = 'x';
+	hex.plain = 0;
+	hex.elem = ELEM_U64;
+	return (ft_format_array(out, vals, n, &hex));
+}
@@ -0,0 +1,43 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_human_scale_bonus.c                             :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: rmourey- <rmourey-@student.42madrid.com>   +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 11:46:23 by rmourey-          #+#    #+#             */
+/*   Updated: 2026/10/18 11:46:23 by rmourey-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "ft_printf_bonus.h"
+
+t_uwide	ft_upow10(int n)
+{
+	t_uwide	pow;
+
+	pow = 1;
+	while (n-- > 0)
+		pow *= 10;
+	return (pow);
+}
+
+t_uwide	ft_scale_bin(t_uwide v, int shift, t_uwide pow)
+{
+	t_uwide	rem;
+	int		drop;
+
+	if (shift == 0)
+		return (v * pow);
+	drop = 0;
+	if (shift > 50)
+		drop = shift - 50;
+	rem = (v & (((t_uwide)1 << shift) - 1)) >> drop;
+	return ((v >> shift) * pow
+		+ ((rem * pow + ((t_uwide)1 << (shift - drop - 1))) >> (shift - drop)));
+}
+
+t_uwide	ft_scale_dec(t_uwide v, t_uwide div, t_uwide pow)
+{
+	return ((v / div) * pow + ((v % div) * pow + div / 2) / div);
+}
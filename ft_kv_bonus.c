@@ -0,0 +1,59 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_kv_bonus.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: rmourey- <rmourey-@student.42madrid.com>   +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 15:46:04 by rmourey-          #+#    #+#             */
+/*   Updated: 2026/10/18 15:46:04 by rmourey-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "ft_printf_bonus.h"
+
+/* Typed values for ft_logkv and ft_logfmt. The variadic calls take
+   t_cell by value, so every value must be built with one of these. */
+t_cell	ft_kv_str(const char *s)
+{
+	t_cell	cell;
+
+	cell.kind = CELL_STR;
+	cell.s = s;
+	cell.i = 0;
+	cell.d = 0;
+	return (cell);
+}
+
+t_cell	ft_kv_i64(int64_t v)
+{
+	t_cell	cell;
+
+	cell.kind = CELL_INT;
+	cell.s = NULL;
+	cell.i = v;
+	cell.d = 0;
+	return (cell);
+}
+
+t_cell	ft_kv_u64(uint64_t v)
+{
+	t_cell	cell;
+
+	cell.kind = CELL_UINT;
+	cell.s = NULL;
+	cell.i = (t_wide)v;
+	cell.d = 0;
+	return (cell);
+}
+
+t_cell	ft_kv_f64(double v)
+{
+	t_cell	cell;
+
+	cell.kind = CELL_DOUBLE;
+	cell.s = NULL;
+	cell.i = 0;
+	cell.d = v;
+	return (cell);
+}
@@ -0,0 +1,101 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_kv_value_bonus.c                                :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: rmourey- <rmourey-@student.42madrid.com>   +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 15:49:21 by rmourey-          #+#    #+#             */
+/*   Updated: 2026/10/18 18:33:31 by rmourey-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "ft_printf_bonus.h"
+
+static const t_fmt	g_kv_spec = {0, 0, 0, 0, 0, 0, -1, LEN_NONE, 'q'};
+
+/* logfmt leaves a value unquoted when it is non-empty and has no space,
+   control byte, '=', quote or backslash. */
+static int	ft_kv_bare(const char *s, size_t len)
+{
+	size_t	i;
+
+	i = 0;
+	while (i < len && (unsigned char)s[i] > ' ' && s[i] != '='
+		&& s[i] != '"' && s[i] != '\\' && s[i] != 0x7F)
+		i++;
+	return (len > 0 && i == len);
+}
+
+/* Shortest digits that read back to the same double, laid out as %g.
+   The precision covers every integer digit, so integral values below
+   1e17 print without an exponent (100, not 1e+02). Subnormals have no
+   shortest form here and get 17 digits. JSON has no inf or nan: they
+   become null. */
+static int	ft_kv_double(t_sink *out, double v, int json)
+{
+	t_fmt				sp;
+	t_dec				dec;
+	unsigned long long	bits;
+
+	ft_memcpy(&bits, &v, sizeof(bits));
+	if (json && ((bits >> 52) & 0x7FF) == 0x7FF)
+		return (ft_putnstr_count(out, "null", 4));
+	sp = g_kv_spec;
+	sp.specifier = 'g';
+	sp.precision = 17;
+	if (((bits >> 52) & 0x7FF) != 0 && ((bits >> 52) & 0x7FF) != 0x7FF)
+	{
+		ft_dtoa_shortest(bits & ~(1ULL << 63), &dec);
+		sp.precision = dec.len;
+		if (dec.exp + 1 > dec.len && dec.exp < 17)
+			sp.precision = dec.exp + 1;
+	}
+	return (ft_print_float(out, v, &sp));
+}
+
+/* Strings are quoted with JSON escapes in both modes; logfmt drops the
+   quotes when the value does not need them. A null string is JSON null
+   and an empty logfmt value. */
+int	ft_kv_value(t_sink *out, const t_cell *cell, int json)
+{
+	t_fmt	sp;
+	size_t	len;
+
+	if (cell->kind == CELL_DOUBLE)
+		return (ft_kv_double(out, cell->d, json));
+	sp = g_kv_spec;
+	sp.specifier = 'd';
+	if (cell->kind == CELL_INT)
+		return (ft_print_nbr(out, cell->i, &sp));
+	sp.specifier = 'u';
+	if (cell->kind == CELL_UINT)
+		return (ft_print_unsigned(out, (t_uwide)cell->i, &sp));
+	sp.specifier = 'q';
+	if (!cell->s && json)
+		return (ft_putnstr_count(out, "null", 4));
+	if (!cell->s)
+		return (0);
+	len = ft_strlen(cell->s);
+	if (!json && ft_kv_bare(cell->s, len))
+		return (ft_putnstr_count(out, cell->s, len));
+	return (ft_print_escaped(out, cell->s, &sp));
+}
+
+/* Separator and key. logfmt keys are written as given; JSON keys are
+   escaped like string values. */
+int	ft_kv_key(t_sink *out, const char *key, int first, int json)
+{
+	t_fmt	sp;
+	int		count;
+
+	count = 0;
+	if (!first)
+		count += ft_putchar_count(out, " ,"[json]);
+	if (!json)
+		return (count + ft_putnstr_count(out, key, ft_strlen(key))
+			+ ft_putchar_count(out, '='));
+	sp = g_kv_spec;
+	return (count + ft_print_escaped(out, key, &sp)
+		+ ft_putchar_count(out, ':'));
+}
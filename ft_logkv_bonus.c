@@ -0,0 +1,65 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_logkv_bonus.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: rmourey- <rmourey-@student.42madrid.com>   +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 15:52:38 by rmourey-          #+#    #+#             */
+/*   Updated: 2026/10/18 15:52:38 by rmourey-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "ft_printf_bonus.h"
+
+/* Key/value pairs up to a NULL key, written as one line: a JSON object
+   when json is set, logfmt otherwise. */
+int	ft_vlogkv(t_sink *out, int json, va_list *args)
+{
+	const char	*key;
+	t_cell		val;
+	int			count;
+	int			first;
+
+	count = 0;
+	if (json)
+		count += ft_putchar_count(out, '{');
+	first = 1;
+	key = va_arg(*args, const char *);
+	while (key)
+	{
+		val = va_arg(*args, t_cell);
+		count += ft_kv_key(out, key, first, json);
+		count += ft_kv_value(out, &val, json);
+		first = 0;
+		key = va_arg(*args, const char *);
+	}
+	if (json)
+		count += ft_putchar_count(out, '}');
+	return (count + ft_putchar_count(out, '\n'));
+}
+
+/* ft_logkv(out, "user", ft_kv_str(u), "latency_us", ft_kv_u64(l), NULL)
+   writes {"user":"...","latency_us":...} and a newline. */
+int	ft_logkv(t_sink *out, ...)
+{
+	va_list	args;
+	int		count;
+
+	va_start(args, out);
+	count = ft_vlogkv(out, 1, &args);
+	va_end(args);
+	return (count);
+}
+
+/* Same pairs as ft_logkv, written as user=... latency_us=... */
+int	ft_logfmt(t_sink *out, ...)
+{
+	va_list	args;
+	int		count;
+
+	va_start(args, out);
+	count = ft_vlogkv(out, 0, &args);
+	va_end(args);
+	return (count);
+}
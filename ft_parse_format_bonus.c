@@ -6,7 +6,7 @@
 /*   By: rmourey- <rmourey-@student.42madrid.com>   +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2026/01/27 12:30:00 by rmourey-          #+#    #+#             */
-/*   Updated: 2026/01/27 12:30:00 by rmourey-         ###   ########.fr       */
+/*   Updated: 2026/10/18 16:12:20 by rmourey-         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -21,6 +21,7 @@ static void	ft_init_spec(t_fmt *spec)
 	spec->plus = 0;
 	spec->width = 0;
 	spec->precision = -1;
+	spec->length = LEN_NONE;
 	spec->specifier = 0;
 }
 
@@ -72,7 +73,8 @@ int	ft_parse_format(const char *fmt, int *i, t_fmt *spec)
 	ft_parse_flags(fmt, i, spec);
 	ft_parse_width(fmt, i, spec);
 	ft_parse_precision(fmt, i, spec);
-	if (fmt[*i] && ft_strchr("cspdiuxX%", fmt[*i]))
+	ft_parse_length(fmt, i, spec);
+	if (fmt[*i] && ft_strchr("cspdiuxXobBkHNfFeEgGaAqMRT%", fmt[*i]))
 	{
 		spec->specifier = fmt[*i];
 		return (1);
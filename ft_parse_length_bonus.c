@@ -0,0 +1,58 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_parse_length_bonus.c                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: rmourey- <rmourey-@student.42madrid.com>   +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 09:38:20 by rmourey-          #+#    #+#             */
+/*   Updated: 2026/10/18 09:38:20 by rmourey-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "ft_printf_bonus.h"
+
+static int	ft_parse_width_length(const char *fmt, int *i, t_fmt *spec)
+{
+	if (!ft_strncmp(fmt + *i, "w128", 4) && FT_HAS_INT128)
+		spec->length = LEN_128;
+	else if (!ft_strncmp(fmt + *i, "w64", 3))
+		spec->length = LEN_LL;
+	else if (!ft_strncmp(fmt + *i, "w32", 3))
+		spec->length = LEN_NONE;
+	else if (!ft_strncmp(fmt + *i, "w16", 3))
+		spec->length = LEN_H;
+	else if (!ft_strncmp(fmt + *i, "w8", 2))
+		spec->length = LEN_HH;
+	else
+		return (0);
+	(*i)++;
+	while (ft_isdigit(fmt[*i]))
+		(*i)++;
+	return (1);
+}
+
+void	ft_parse_length(const char *fmt, int *i, t_fmt *spec)
+{
+	if (fmt[*i] == 'w' && ft_parse_width_length(fmt, i, spec))
+		return ;
+	if (fmt[*i] == 'h' && fmt[*i + 1] == 'h')
+		spec->length = LEN_HH;
+	else if (fmt[*i] == 'l' && fmt[*i + 1] == 'l')
+		spec->length = LEN_LL;
+	else if (fmt[*i] == 'h')
+		spec->length = LEN_H;
+	else if (fmt[*i] == 'l')
+		spec->length = LEN_L;
+	else if (fmt[*i] == 'z')
+		spec->length = LEN_Z;
+	else if (fmt[*i] == 'j')
+		spec->length = LEN_J;
+	else if (fmt[*i] == 't')
+		spec->length = LEN_T;
+	else
+		return ;
+	(*i)++;
+	if (spec->length == LEN_HH || spec->length == LEN_LL)
+		(*i)++;
+}
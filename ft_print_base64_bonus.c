@@ -0,0 +1,110 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_print_base64_bonus.c                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: rmourey- <rmourey-@student.42madrid.com>   +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 14:14:08 by rmourey-          #+#    #+#             */
+/*   Updated: 2026/10/18 14:14:08 by rmourey-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "ft_printf_bonus.h"
+
+static const char *const	g_b64_alphabet[2] = {
+	"ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/",
+	"ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789-_"};
+
+static size_t	ft_b64_scalar(const unsigned char *p, size_t n, char *dst,
+					const char *abc)
+{
+	size_t	done;
+
+	done = 0;
+	while (n - done >= 3)
+	{
+		dst[0] = abc[p[done] >> 2];
+		dst[1] = abc[((p[done] & 3) << 4) | (p[done + 1] >> 4)];
+		dst[2] = abc[((p[done + 1] & 15) << 2) | (p[done + 2] >> 6)];
+		dst[3] = abc[p[done + 2] & 63];
+		done += 3;
+		dst += 4;
+	}
+	return (done);
+}
+
+static size_t	ft_b64_tail(const unsigned char *p, size_t n, char *dst,
+					int url)
+{
+	const char	*abc;
+
+	abc = g_b64_alphabet[url];
+	dst[0] = abc[p[0] >> 2];
+	if (n == 1)
+		dst[1] = abc[(p[0] & 3) << 4];
+	else
+	{
+		dst[1] = abc[((p[0] & 3) << 4) | (p[1] >> 4)];
+		dst[2] = abc[(p[1] & 15) << 2];
+	}
+	if (url)
+		return (n + 1);
+	dst[n + 1] = '=';
+	dst[3] = '=';
+	return (4);
+}
+
+static size_t	ft_b64_encode(const unsigned char *p, size_t n, char *dst,
+					int url)
+{
+	size_t	done;
+	size_t	len;
+
+	done = ft_b64_block(p, n, dst, g_b64_alphabet[url]);
+	len = done / 3 * 4;
+	done += ft_b64_scalar(p + done, n - done, dst + len, g_b64_alphabet[url]);
+	len = done / 3 * 4;
+	if (done < n)
+		len += ft_b64_tail(p + done, n - done, dst + len, url);
+	return (len);
+}
+
+static int	ft_b64_len(size_t n, int url)
+{
+	if (n % 3 == 0)
+		return ((int)(n / 3 * 4));
+	if (url)
+		return ((int)(n / 3 * 4 + n % 3 + 1));
+	return ((int)(n / 3 * 4 + 4));
+}
+
+int	ft_print_base64(t_sink *out, const unsigned char *p, size_t n,
+		t_fmt *spec)
+{
+	char	buf[FT_B64_CHUNK / 3 * 4];
+	size_t	step;
+	int		count;
+
+	if (!p)
+		n = 0;
+	if (spec->precision >= 0 && (size_t)spec->precision < n)
+		n = spec->precision;
+	count = 0;
+	if (!spec->minus)
+		count += ft_print_padding(out,
+				spec->width - ft_b64_len(n, spec->hash != 0), ' ');
+	while (n > 0)
+	{
+		step = n;
+		if (step > FT_B64_CHUNK)
+			step = FT_B64_CHUNK;
+		count += ft_putnstr_count(out, buf,
+				ft_b64_encode(p, step, buf, spec->hash != 0));
+		p += step;
+		n -= step;
+	}
+	if (spec->minus)
+		count += ft_print_padding(out, spec->width - count, ' ');
+	return (count);
+}
@@ -0,0 +1,109 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_print_escaped_bonus.c                           :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: rmourey- <rmourey-@student.42madrid.com>   +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 13:41:18 by rmourey-          #+#    #+#             */
+/*   Updated: 2026/10/18 18:03:58 by rmourey-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "ft_printf_bonus.h"
+
+static const char *const	g_escape_from[2] = {"\b\t\n\f\r\"\\",
+	"\a\b\t\n\v\f\r\"\\"};
+static const char *const	g_escape_to[2] = {"btnfr\"\\", "abtnvfr\"\\"};
+
+static int	ft_escape_seq(unsigned char c, int cstyle, char *seq)
+{
+	const char	*hit;
+
+	seq[0] = '\\';
+	hit = ft_strchr(g_escape_from[cstyle], c);
+	if (hit)
+	{
+		seq[1] = g_escape_to[cstyle][hit - g_escape_from[cstyle]];
+		return (2);
+	}
+	if (cstyle)
+	{
+		seq[1] = '0' + (c >> 6);
+		seq[2] = '0' + ((c >> 3) & 7);
+		seq[3] = '0' + (c & 7);
+		return (4);
+	}
+	ft_memcpy(seq + 1, "u00", 3);
+	seq[4] = "0123456789abcdef"[c >> 4];
+	seq[5] = "0123456789abcdef"[c & 15];
+	return (6);
+}
+
+/* Escapes at most max bytes of s into out, or only measures the result
+   when out is NULL. */
+static size_t	ft_escape_walk(t_sink *out, const char *s, size_t max,
+					int cstyle)
+{
+	size_t	total;
+	size_t	run;
+	char	seq[8];
+	int		len;
+
+	total = 0;
+	while (max > 0)
+	{
+		run = ft_escape_span(s, max, cstyle);
+		if (out)
+			ft_sink_write(out, s, run);
+		total += run;
+		s += run;
+		max -= run;
+		if (max == 0 || *s == '\0')
+			break ;
+		len = ft_escape_seq((unsigned char)*s++, cstyle, seq);
+		max--;
+		if (out)
+			ft_sink_write(out, seq, len);
+		total += len;
+	}
+	return (total);
+}
+
+/* A NULL string is JSON null, unquoted and never cut by the precision;
+   the C-style form keeps printf's (null). */
+static int	ft_print_escaped_null(t_sink *out, t_fmt *spec)
+{
+	t_fmt	whole;
+
+	if (spec->hash)
+		return (ft_print_str(out, NULL, spec));
+	whole = *spec;
+	whole.precision = -1;
+	return (ft_print_str(out, "null", &whole));
+}
+
+int	ft_print_escaped(t_sink *out, const char *s, t_fmt *spec)
+{
+	size_t	max;
+	int		len;
+	int		count;
+
+	if (!s)
+		return (ft_print_escaped_null(out, spec));
+	max = SIZE_MAX;
+	if (spec->precision >= 0)
+		max = spec->precision;
+	len = 0;
+	if (spec->width > 0)
+		len = (int)ft_escape_walk(NULL, s, max, spec->hash != 0) + 2;
+	count = 0;
+	if (!spec->minus)
+		count += ft_print_padding(out, spec->width - len, ' ');
+	count += ft_putchar_count(out, '"');
+	count += (int)ft_escape_walk(out, s, max, spec->hash != 0);
+	count += ft_putchar_count(out, '"');
+	if (spec->minus)
+		count += ft_print_padding(out, spec->width - len, ' ');
+	return (count);
+}
@@ -0,0 +1,47 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_print_fixed_bonus.c                             :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: rmourey- <rmourey-@student.42madrid.com>   +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 11:26:41 by rmourey-          #+#    #+#             */
+/*   Updated: 2026/10/18 11:52:57 by rmourey-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "ft_printf_bonus.h"
+
+int	ft_fixed_body(t_num *num, int scale)
+{
+	char	*end;
+	int		len;
+
+	end = num->buf + FT_INT_BUF;
+	len = ft_uwide_declen(num->value);
+	ft_utoa_dec(num->value, end);
+	while (len < scale + 1)
+		*(end - ++len) = '0';
+	if (scale == 0)
+		return (len);
+	ft_memmove(end - len - 1, end - len, len - scale);
+	*(end - scale - 1) = '.';
+	return (len + 1);
+}
+
+int	ft_print_fixed(t_sink *out, t_wide n, t_fmt *spec)
+{
+	t_num	num;
+	t_fmt	sp;
+	int		scale;
+
+	scale = spec->precision;
+	if (scale < 0)
+		scale = 0;
+	if (scale > FT_FIXED_SCALE_MAX)
+		scale = FT_FIXED_SCALE_MAX;
+	sp = *spec;
+	sp.precision = -1;
+	ft_signed_num(&num, n, spec);
+	return (ft_print_digits(out, &num, &sp, ft_fixed_body(&num, scale)));
+}
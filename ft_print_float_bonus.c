@@ -0,0 +1,121 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_print_float_bonus.c                             :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: rmourey- <rmourey-@student.42madrid.com>   +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 12:32:21 by rmourey-          #+#    #+#             */
+/*   Updated: 2026/10/18 12:52:03 by rmourey-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "ft_printf_bonus.h"
+
+static const char *const	g_float_specials[4] = {"inf", "nan", "INF", "NAN"};
+
+static int	ft_float_special(t_sink *out, unsigned long long bits,
+				t_fmt *spec)
+{
+	char	s[5];
+	t_fmt	sp;
+	int		i;
+
+	i = 0;
+	if (bits >> 63)
+		s[i++] = '-';
+	else if (spec->plus)
+		s[i++] = '+';
+	else if (spec->space)
+		s[i++] = ' ';
+	ft_strlcpy(s + i, g_float_specials[((bits & ((1ULL << 52) - 1)) != 0)
+		+ 2 * (ft_toupper(spec->specifier) == spec->specifier)], 4);
+	sp = *spec;
+	sp.precision = -1;
+	return (ft_print_str(out, s, &sp));
+}
+
+static void	ft_float_g(double v, t_dec *dec, t_fmt *sp)
+{
+	int	p;
+	int	limit;
+
+	p = sp->precision + (sp->precision == 0);
+	ft_dtoa(v, dec, 'e', p - 1);
+	dec->style = 'e';
+	sp->precision = p - 1;
+	limit = dec->len - 1;
+	if (p > dec->exp && dec->exp >= -4)
+	{
+		dec->style = 'f';
+		sp->precision = p - 1 - dec->exp;
+		limit -= dec->exp;
+	}
+	if (sp->hash)
+		return ;
+	if (limit < 0)
+		limit = 0;
+	if (sp->precision > limit)
+		sp->precision = limit;
+}
+
+static char	ft_float_sign(t_dec *dec, t_fmt *sp)
+{
+	if (dec->neg)
+		return ('-');
+	if (sp->plus)
+		return ('+');
+	if (sp->space)
+		return (' ');
+	return (0);
+}
+
+static int	ft_float_emit(t_sink *out, t_dec *dec, t_fmt *sp)
+{
+	char	sign;
+	int		len;
+	int		count;
+
+	sign = ft_float_sign(dec, sp);
+	if (dec->style == 'f')
+		len = ft_float_flen(dec, sp) + (sign != 0);
+	else
+		len = ft_float_elen(dec, sp) + (sign != 0);
+	count = 0;
+	if (!sp->minus && !sp->zero)
+		count += ft_print_padding(out, sp->width - len, ' ');
+	if (sign)
+		count += ft_putchar_count(out, sign);
+	if (!sp->minus && sp->zero)
+		count += ft_print_padding(out, sp->width - len, '0');
+	if (dec->style == 'f')
+		count += ft_float_fbody(out, dec, sp);
+	else
+		count += ft_float_ebody(out, dec, sp);
+	if (sp->minus)
+		count += ft_print_padding(out, sp->width - len, ' ');
+	return (count);
+}
+
+int	ft_print_float(t_sink *out, double v, t_fmt *spec)
+{
+	t_dec				dec;
+	t_fmt				sp;
+	unsigned long long	bits;
+
+	ft_memcpy(&bits, &v, sizeof(bits));
+	if (((bits >> 52) & 0x7ff) == 0x7ff)
+		return (ft_float_special(out, bits, spec));
+	dec.neg = (int)(bits >> 63);
+	dec.style = ft_tolower(spec->specifier);
+	if (dec.style == 'a')
+		return (ft_print_hexfloat(out, bits, ft_float_sign(&dec, spec), spec));
+	sp = *spec;
+	if (sp.precision < 0)
+		sp.precision = 6;
+	if (dec.style == 'g')
+		ft_float_g(v, &dec, &sp);
+	else
+		ft_dtoa(v, &dec, dec.style, sp.precision);
+	return (ft_float_emit(out, &dec, &sp));
+}
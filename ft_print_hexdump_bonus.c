@@ -0,0 +1,128 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_print_hexdump_bonus.c                           :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: rmourey- <rmourey-@student.42madrid.com>   +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 13:54:26 by rmourey-          #+#    #+#             */
+/*   Updated: 2026/10/18 13:54:26 by rmourey-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "ft_printf_bonus.h"
+
+/* Writes the 2 * n hex digits of p to dst, eight bytes per converter
+   call. */
+static void	ft_dump_hex(const unsigned char *p, size_t n, char *dst)
+{
+	unsigned long long	w;
+	int					i;
+
+	while (n >= 8)
+	{
+		w = 0;
+		i = 0;
+		while (i < 8)
+			w = (w << 8) | p[i++];
+		ft_utoa_hex(w, dst + 16, 0);
+		p += 8;
+		dst += 16;
+		n -= 8;
+	}
+	while (n-- > 0)
+	{
+		*dst++ = "0123456789abcdef"[*p >> 4];
+		*dst++ = "0123456789abcdef"[*p++ & 15];
+	}
+}
+
+/* One "hexdump -C" line: offset, two groups of eight bytes, ASCII. */
+static int	ft_dump_line(const unsigned char *p, size_t n, size_t off,
+				char *line)
+{
+	char	hex[32];
+	size_t	i;
+
+	ft_memset(line, ' ', FT_DUMP_ASCII);
+	ft_utoa_hex(off, hex + 16, 0);
+	ft_memcpy(line, hex + 8, 8);
+	ft_dump_hex(p, n, hex);
+	i = 0;
+	while (i < n)
+	{
+		ft_memcpy(line + 10 + 3 * i + (i >= 8), hex + 2 * i, 2);
+		line[FT_DUMP_ASCII + 1 + i] = '.';
+		if (p[i] >= 0x20 && p[i] < 0x7F)
+			line[FT_DUMP_ASCII + 1 + i] = p[i];
+		i++;
+	}
+	line[FT_DUMP_ASCII] = '|';
+	line[FT_DUMP_ASCII + 1 + n] = '|';
+	line[FT_DUMP_ASCII + 2 + n] = '\n';
+	return (FT_DUMP_ASCII + 3 + n);
+}
+
+static int	ft_dump_classic(t_sink *out, const unsigned char *p, size_t n)
+{
+	char	line[FT_DUMP_ASCII + 20];
+	size_t	off;
+	size_t	step;
+	int		count;
+
+	off = 0;
+	count = 0;
+	while (off < n)
+	{
+		step = n - off;
+		if (step > 16)
+			step = 16;
+		count += ft_putnstr_count(out, line,
+				ft_dump_line(p + off, step, off, line));
+		off += step;
+	}
+	return (count);
+}
+
+static int	ft_dump_compact(t_sink *out, const unsigned char *p, size_t n)
+{
+	char	buf[2 * FT_DUMP_CHUNK];
+	size_t	step;
+	int		count;
+
+	count = 0;
+	while (n > 0)
+	{
+		step = n;
+		if (step > FT_DUMP_CHUNK)
+			step = FT_DUMP_CHUNK;
+		ft_dump_hex(p, step, buf);
+		count += ft_putnstr_count(out, buf, 2 * step);
+		p += step;
+		n -= step;
+	}
+	return (count);
+}
+
+int	ft_print_hexdump(t_sink *out, const void *p, size_t n, t_fmt *spec)
+{
+	int	count;
+	int	pad;
+
+	if (!p)
+		n = 0;
+	if (spec->precision >= 0 && (size_t)spec->precision < n)
+		n = spec->precision;
+	if (spec->hash)
+		return (ft_dump_classic(out, p, n));
+	pad = 0;
+	if (spec->width > 0 && (size_t)spec->width > 2 * n)
+		pad = spec->width - (int)(2 * n);
+	count = 0;
+	if (!spec->minus)
+		count += ft_print_padding(out, pad, ' ');
+	count += ft_dump_compact(out, p, n);
+	if (spec->minus)
+		count += ft_print_padding(out, pad, ' ');
+	return (count);
+}
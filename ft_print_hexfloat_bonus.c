@@ -0,0 +1,109 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_print_hexfloat_bonus.c                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: rmourey- <rmourey-@student.42madrid.com>   +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 12:48:46 by rmourey-          #+#    #+#             */
+/*   Updated: 2026/10/18 19:42:28 by rmourey-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "ft_printf_bonus.h"
+
+static unsigned long long	ft_hexfloat_round(unsigned long long full,
+		int prec)
+{
+	unsigned long long	rem;
+	unsigned long long	half;
+	int					shift;
+
+	if (prec < 0 || prec >= 13)
+		return (full);
+	shift = 52 - 4 * prec;
+	rem = full & ((1ULL << shift) - 1);
+	half = 1ULL << (shift - 1);
+	full >>= shift;
+	if (rem > half || (rem == half && (full & 1)))
+		full++;
+	return (full << shift);
+}
+
+static int	ft_hexfloat_mant(unsigned long long bits, t_fmt *spec, char *buf)
+{
+	unsigned long long	full;
+	char				hex[16];
+	int					upper;
+	int					ndig;
+
+	full = bits & ((1ULL << 52) - 1);
+	if ((bits >> 52) & 0x7ff)
+		full |= 1ULL << 52;
+	full = ft_hexfloat_round(full, spec->precision);
+	upper = (spec->specifier == 'A');
+	ft_utoa_hex(full & ((1ULL << 52) - 1), hex + 16, upper);
+	buf[0] = '0';
+	buf[1] = 'x' - upper * ('a' - 'A');
+	buf[2] = '0' + (full >> 52);
+	ndig = 13;
+	if (spec->precision >= 0 && spec->precision < 13)
+		ndig = spec->precision;
+	while (spec->precision < 0 && ndig > 0 && hex[2 + ndig] == '0')
+		ndig--;
+	buf[3] = '.';
+	ft_memcpy(buf + 4, hex + 3, ndig);
+	if (ndig > 0 || spec->hash || spec->precision > 13)
+		return (4 + ndig);
+	return (3);
+}
+
+static int	ft_hexfloat_exp(unsigned long long bits, t_fmt *spec, char *buf)
+{
+	int	e;
+	int	len;
+
+	e = (int)((bits >> 52) & 0x7ff);
+	if (e == 0)
+		e = -1022 * ((bits & ((1ULL << 52) - 1)) != 0);
+	else
+		e -= 1023;
+	buf[0] = 'p' - (spec->specifier == 'A') * ('a' - 'A');
+	buf[1] = '+';
+	if (e < 0)
+		buf[1] = '-';
+	if (e < 0)
+		e = -e;
+	len = ft_declen(e);
+	ft_utoa_dec(e, buf + 2 + len);
+	return (2 + len);
+}
+
+int	ft_print_hexfloat(t_sink *out, unsigned long long bits, char sign,
+		t_fmt *spec)
+{
+	char	mant[20];
+	char	exp[8];
+	int		l[4];
+
+	l[0] = ft_hexfloat_mant(bits, spec, mant);
+	l[1] = ft_hexfloat_exp(bits, spec, exp);
+	l[2] = (spec->precision - 13) * (spec->precision > 13);
+	l[3] = spec->width - (sign != 0) - l[0] - l[1] - l[2];
+	l[0] -= 2;
+	if (!spec->minus && !spec->zero)
+		ft_print_padding(out, l[3], ' ');
+	if (sign)
+		ft_putchar_count(out, sign);
+	ft_putnstr_count(out, mant, 2);
+	if (!spec->minus && spec->zero)
+		ft_print_padding(out, l[3], '0');
+	ft_putnstr_count(out, mant + 2, l[0]);
+	ft_print_padding(out, l[2], '0');
+	ft_putnstr_count(out, exp, l[1]);
+	if (spec->minus)
+		ft_print_padding(out, l[3], ' ');
+	if (l[3] < 0)
+		l[3] = 0;
+	return ((sign != 0) + l[0] + 2 + l[1] + l[2] + l[3]);
+}
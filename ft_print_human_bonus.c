@@ -0,0 +1,93 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_print_human_bonus.c                             :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: rmourey- <rmourey-@student.42madrid.com>   +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 11:49:40 by rmourey-          #+#    #+#             */
+/*   Updated: 2026/10/18 11:49:40 by rmourey-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "ft_printf_bonus.h"
+
+static const char *const	g_size_units[7] = {"B", "KiB", "MiB", "GiB",
+	"TiB", "PiB", "EiB"};
+static const char *const	g_time_units[4] = {"ns", "us", "ms", "s"};
+
+static void	ft_human_spec(t_fmt *sp, t_fmt *spec)
+{
+	*sp = *spec;
+	if (sp->precision < 0)
+		sp->precision = 1;
+	if (sp->precision > FT_HUMAN_SCALE_MAX)
+		sp->precision = FT_HUMAN_SCALE_MAX;
+}
+
+static int	ft_human_emit(t_sink *out, t_num *num, const char *unit,
+				t_fmt *sp)
+{
+	char	s[FT_INT_BUF + 8];
+	int		plen;
+	int		len;
+
+	plen = ft_strlcpy(s, num->prefix, sizeof(s));
+	len = ft_fixed_body(num, sp->precision);
+	ft_memcpy(s + plen, num->buf + FT_INT_BUF - len, len);
+	len += plen;
+	s[len++] = ' ';
+	ft_strlcpy(s + len, unit, sizeof(s) - len);
+	sp->precision = -1;
+	return (ft_print_str(out, s, sp));
+}
+
+int	ft_print_size(t_sink *out, t_uwide bytes, t_fmt *spec)
+{
+	t_num	num;
+	t_fmt	sp;
+	t_uwide	pow;
+	int		u;
+
+	ft_human_spec(&sp, spec);
+	u = 0;
+	while (u < 6 && (bytes >> (10 * u) >> 10) != 0)
+		u++;
+	if (u == 0)
+		sp.precision = 0;
+	pow = ft_upow10(sp.precision);
+	num.value = ft_scale_bin(bytes, 10 * u, pow);
+	if (u > 0 && u < 6 && num.value >= 1024 * pow)
+		num.value = ft_scale_bin(bytes, 10 * ++u, pow);
+	num.prefix[0] = '\0';
+	return (ft_human_emit(out, &num, g_size_units[u], &sp));
+}
+
+int	ft_print_duration(t_sink *out, t_wide ns, t_fmt *spec)
+{
+	t_num	num;
+	t_fmt	sp;
+	t_uwide	div;
+	int		u;
+
+	ft_human_spec(&sp, spec);
+	ft_signed_num(&num, ns, spec);
+	u = 0;
+	div = 1;
+	while (u < 3 && num.value >= div * 1000)
+	{
+		div *= 1000;
+		u++;
+	}
+	if (u == 0)
+		sp.precision = 0;
+	if (u > 0 && u < 3
+		&& ft_scale_dec(num.value, div, ft_upow10(sp.precision))
+		>= 1000 * ft_upow10(sp.precision))
+	{
+		div *= 1000;
+		u++;
+	}
+	num.value = ft_scale_dec(num.value, div, ft_upow10(sp.precision));
+	return (ft_human_emit(out, &num, g_time_units[u], &sp));
+}
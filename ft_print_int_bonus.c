@@ -0,0 +1,84 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_print_int_bonus.c                               :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: rmourey- <rmourey-@student.42madrid.com>   +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 10:27:35 by rmourey-          #+#    #+#             */
+/*   Updated: 2026/10/18 14:46:58 by rmourey-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "ft_printf_bonus.h"
+
+static int	ft_int_len(t_num *num)
+{
+	if (num->base == 10)
+		return (ft_uwide_declen(num->value));
+	if (num->base == 16)
+		return ((ft_uwide_bitlen(num->value) + 3) / 4);
+	if (num->base == 8)
+		return ((ft_uwide_bitlen(num->value) + 2) / 3);
+	return (ft_uwide_bitlen(num->value));
+}
+
+static void	ft_int_digits(t_num *num, char *end, int len)
+{
+	if (num->base == 10)
+		ft_utoa_dec(num->value, end);
+	else if (num->base == 16)
+		ft_utoa_hex(num->value, end, num->upper);
+	else if (num->base == 8)
+		ft_utoa_oct(num->value, end, len);
+	else
+		ft_utoa_bin(num->value, end, len);
+}
+
+static int	ft_int_emit(t_sink *out, t_num *num, t_fmt *spec, int *l)
+{
+	int	count;
+
+	count = 0;
+	if (!spec->minus)
+		count += ft_print_padding(out, l[3], ' ');
+	count += ft_putnstr_count(out, num->prefix, l[2]);
+	count += ft_print_padding(out, l[1], '0');
+	count += ft_putnstr_count(out, num->buf + FT_INT_BUF - l[0], l[0]);
+	if (spec->minus)
+		count += ft_print_padding(out, l[3], ' ');
+	return (count);
+}
+
+int	ft_print_digits(t_sink *out, t_num *num, t_fmt *spec, int len)
+{
+	int	l[4];
+
+	l[0] = len;
+	l[1] = 0;
+	if (spec->precision > l[0])
+		l[1] = spec->precision - l[0];
+	if (num->base == 8 && spec->hash && l[1] == 0
+		&& (num->value != 0 || l[0] == 0))
+		l[1] = 1;
+	l[2] = ft_strlen(num->prefix);
+	l[3] = spec->width - l[0] - l[1] - l[2];
+	if (spec->zero && spec->precision < 0 && !spec->minus && l[3] > 0)
+	{
+		l[1] += l[3];
+		l[3] = 0;
+	}
+	return (ft_int_emit(out, num, spec, l));
+}
+
+int	ft_print_integer(t_sink *out, t_num *num, t_fmt *spec)
+{
+	int	len;
+
+	len = 0;
+	if (num->value != 0 || spec->precision != 0)
+		len = ft_int_len(num);
+	if (len > 0 && !ft_sink_discards(out))
+		ft_int_digits(num, num->buf + FT_INT_BUF, len);
+	return (ft_print_digits(out, num, spec, len));
+}
@@ -0,0 +1,81 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_print_radix_bonus.c                             :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: rmourey- <rmourey-@student.42madrid.com>   +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 10:30:52 by rmourey-          #+#    #+#             */
+/*   Updated: 2026/10/18 11:33:15 by rmourey-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "ft_printf_bonus.h"
+
+static void	ft_init_num(t_num *num, t_uwide value, int base, int upper)
+{
+	num->value = value;
+	num->base = base;
+	num->upper = upper;
+	num->prefix[0] = '\0';
+	num->prefix[1] = '\0';
+	num->prefix[2] = '\0';
+}
+
+void	ft_signed_num(t_num *num, t_wide n, t_fmt *spec)
+{
+	ft_init_num(num, (t_uwide)n, 10, 0);
+	if (n < 0)
+	{
+		num->value = -num->value;
+		num->prefix[0] = '-';
+	}
+	else if (spec->plus)
+		num->prefix[0] = '+';
+	else if (spec->space)
+		num->prefix[0] = ' ';
+}
+
+int	ft_print_nbr(t_sink *out, t_wide n, t_fmt *spec)
+{
+	t_num	num;
+
+	ft_signed_num(&num, n, spec);
+	return (ft_print_integer(out, &num, spec));
+}
+
+int	ft_print_unsigned(t_sink *out, t_uwide n, t_fmt *spec)
+{
+	t_num	num;
+	char	c;
+
+	c = spec->specifier;
+	if (c == 'x' || c == 'X')
+		ft_init_num(&num, n, 16, c == 'X');
+	else if (c == 'o')
+		ft_init_num(&num, n, 8, 0);
+	else if (c == 'b' || c == 'B')
+		ft_init_num(&num, n, 2, 0);
+	else
+		ft_init_num(&num, n, 10, 0);
+	if (spec->hash && n != 0 && num.base != 10 && num.base != 8)
+	{
+		num.prefix[0] = '0';
+		num.prefix[1] = c;
+	}
+	return (ft_print_integer(out, &num, spec));
+}
+
+int	ft_print_ptr(t_sink *out, void *ptr, t_fmt *spec)
+{
+	t_num	num;
+	t_fmt	sp;
+
+	sp = *spec;
+	sp.zero = 0;
+	sp.precision = -1;
+	ft_init_num(&num, (unsigned long)ptr, 16, 0);
+	num.prefix[0] = '0';
+	num.prefix[1] = 'x';
+	return (ft_print_integer(out, &num, &sp));
+}
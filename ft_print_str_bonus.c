@@ -6,28 +6,13 @@
 /*   By: rmourey- <rmourey-@student.42madrid.com>   +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2026/01/27 12:30:00 by rmourey-          #+#    #+#             */
-/*   Updated: 2026/01/27 12:30:00 by rmourey-         ###   ########.fr       */
+/*   Updated: 2026/10/18 13:08:28 by rmourey-         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #include "ft_printf_bonus.h"
 
-static int	ft_print_str_content(char *s, int len)
-{
-	int	count;
-	int	i;
-
-	count = 0;
-	i = 0;
-	while (i < len)
-	{
-		count += ft_putchar_count(s[i]);
-		i++;
-	}
-	return (count);
-}
-
-int	ft_print_str(char *s, t_fmt *spec)
+int	ft_print_str(t_sink *out, char *s, t_fmt *spec)
 {
 	int	count;
 	int	len;
@@ -36,19 +21,19 @@ int	ft_print_str(char *s, t_fmt *spec)
 	count = 0;
 	if (!s)
 		s = "(null)";
-	len = ft_strlen(s);
-	print_len = len;
-	if (spec->precision >= 0 && spec->precision < len)
-		print_len = spec->precision;
+	len = INT_MAX;
+	if (spec->precision >= 0)
+		len = spec->precision;
+	print_len = ft_strnlen(s, len);
 	if (spec->minus)
 	{
-		count += ft_print_str_content(s, print_len);
-		count += ft_print_padding(spec->width - print_len, ' ');
+		count += ft_putnstr_count(out, s, print_len);
+		count += ft_print_padding(out, spec->width - print_len, ' ');
 	}
 	else
 	{
-		count += ft_print_padding(spec->width - print_len, ' ');
-		count += ft_print_str_content(s, print_len);
+		count += ft_print_padding(out, spec->width - print_len, ' ');
+		count += ft_putnstr_count(out, s, print_len);
 	}
 	return (count);
 }
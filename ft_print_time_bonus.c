@@ -0,0 +1,114 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_print_time_bonus.c                              :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: rmourey- <rmourey-@student.42madrid.com>   +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 16:02:29 by rmourey-          #+#    #+#             */
+/*   Updated: 2026/10/18 19:06:21 by rmourey-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "ft_printf_bonus.h"
+
+static __thread t_tscache	g_ts_cache[2];
+
+/* Renders the YYYY-MM-DDThh:mm:ss prefix and the zone for one second.
+   Local time asks localtime_r for the offset, once per second. */
+static void	ft_ts_fill(t_tscache *c, long long sec, int local)
+{
+	struct tm	tm;
+	time_t		t;
+	long long	off;
+	long long	day;
+
+	off = 0;
+	t = (time_t)sec;
+	if (local && localtime_r(&t, &tm))
+		off = tm.tm_gmtoff;
+	sec += off;
+	day = sec / 86400 - (sec % 86400 < 0);
+	sec -= day * 86400;
+	ft_ts_date(day, c->prefix);
+	c->prefix[10] = 'T';
+	ft_ts_digits(c->prefix + 11, sec / 3600, 2);
+	c->prefix[13] = ':';
+	ft_ts_digits(c->prefix + 14, sec / 60 % 60, 2);
+	c->prefix[16] = ':';
+	ft_ts_digits(c->prefix + 17, sec % 60, 2);
+	c->zlen = ft_ts_zone(c->zone, off);
+	c->sec = (long long)t;
+	c->valid = 1;
+}
+
+/* Moves whole seconds out of ns, then clamps the time to the range
+   FT_TS_SEC_MIN to FT_TS_SEC_MAX: a day inside the years 0000 to 9999,
+   so that neither the four-digit year nor a local offset can leave them.
+   Nothing is multiplied, so no time can overflow. */
+static void	ft_ts_clamp(long long *sec, long long *ns)
+{
+	long long	carry;
+
+	if (*sec >= FT_TS_SEC_MIN && *sec <= FT_TS_SEC_MAX)
+	{
+		carry = *ns / 1000000000 - (*ns % 1000000000 < 0);
+		*sec += carry;
+		*ns -= carry * 1000000000;
+	}
+	if (*sec < FT_TS_SEC_MIN)
+	{
+		*sec = FT_TS_SEC_MIN;
+		*ns = 0;
+	}
+	if (*sec > FT_TS_SEC_MAX)
+	{
+		*sec = FT_TS_SEC_MAX;
+		*ns = 999999999;
+	}
+}
+
+/* %T argument: a struct timespec pointer, or NULL for the current time.
+   Seconds go to arg->i and nanoseconds to arg->n, kept apart. */
+void	ft_time_arg(const struct timespec *ts, t_arg *arg)
+{
+	struct timespec	now;
+	long long		sec;
+	long long		ns;
+
+	if (!ts)
+	{
+		clock_gettime(CLOCK_REALTIME, &now);
+		ts = &now;
+	}
+	sec = ts->tv_sec;
+	ns = ts->tv_nsec;
+	ft_ts_clamp(&sec, &ns);
+	arg->i = sec;
+	arg->n = ns;
+}
+
+/* ISO-8601 with precision as the number of fraction digits: UTC by
+   default, local time with its offset under '#'. The prefix is cached per
+   second and per thread, so most calls only render the fraction. */
+int	ft_print_time(t_sink *out, long long sec, long long ns, t_fmt *spec)
+{
+	t_tscache	*c;
+	char		buf[FT_TS_MAX];
+	int			len;
+	t_fmt		sp;
+
+	ft_ts_clamp(&sec, &ns);
+	c = &g_ts_cache[spec->hash != 0];
+	if (!c->valid || c->sec != sec)
+		ft_ts_fill(c, sec, spec->hash != 0);
+	ft_memcpy(buf, c->prefix, FT_TS_PREFIX);
+	len = FT_TS_PREFIX;
+	len += ft_ts_frac(buf + len, ns, spec->precision);
+	ft_memcpy(buf + len, c->zone, c->zlen);
+	len += c->zlen;
+	buf[len] = '\0';
+	sp = *spec;
+	sp.precision = -1;
+	return (ft_print_str(out, buf, &sp));
+}
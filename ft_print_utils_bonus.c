@@ -6,27 +6,55 @@
 /*   By: rmourey- <rmourey-@student.42madrid.com>   +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2026/01/27 12:30:00 by rmourey-          #+#    #+#             */
-/*   Updated: 2026/02/04 11:38:24 by rmourey-         ###   ########.fr       */
+/*   Updated: 2026/10/18 14:53:32 by rmourey-         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #include "ft_printf_bonus.h"
 
-int	ft_putchar_count(char c)
+static const char	g_pad_spaces[FT_PAD_CHUNK + 1]
+	= "                                                                ";
+static const char	g_pad_zeros[FT_PAD_CHUNK + 1]
+	= "0000000000000000000000000000000000000000000000000000000000000000";
+
+int	ft_putchar_count(t_sink *out, char c)
 {
-	write(1, &c, 1);
+	if (out->fd >= 0 && out->used < FT_SINK_BUF)
+	{
+		out->buf[out->used++] = c;
+		out->len++;
+	}
+	else
+		ft_sink_write(out, &c, 1);
 	return (1);
 }
 
-int	ft_print_padding(int n, char c)
+int	ft_putnstr_count(t_sink *out, const char *s, int n)
+{
+	if (n <= 0)
+		return (0);
+	ft_sink_write(out, s, n);
+	return (n);
+}
+
+int	ft_print_padding(t_sink *out, int n, char c)
 {
-	int	count;
+	int			count;
+	const char	*chunk;
 
+	if (n > 0 && ft_sink_discards(out))
+	{
+		out->len += n;
+		return (n);
+	}
+	chunk = g_pad_spaces;
+	if (c == '0')
+		chunk = g_pad_zeros;
 	count = 0;
-	while (n > 0)
+	while (n > FT_PAD_CHUNK)
 	{
-		count += ft_putchar_count(c);
-		n--;
+		count += ft_putnstr_count(out, chunk, FT_PAD_CHUNK);
+		n -= FT_PAD_CHUNK;
 	}
-	return (count);
+	return (count + ft_putnstr_count(out, chunk, n));
 }
@@ -0,0 +1,110 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_print_wide_bonus.c                              :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: rmourey- <rmourey-@student.42madrid.com>   +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 13:28:10 by rmourey-          #+#    #+#             */
+/*   Updated: 2026/10/18 13:28:10 by rmourey-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "ft_printf_bonus.h"
+
+/* Number of characters of s that fit in limit, counted in bytes (k = 0)
+   or display columns (k = 1). m receives their byte and column totals. */
+static size_t	ft_wide_measure(const wchar_t *s, int limit, int k, int *m)
+{
+	size_t	i;
+	size_t	run;
+	int		cost[2];
+
+	i = 0;
+	m[0] = 0;
+	m[1] = 0;
+	while (s[i])
+	{
+		run = ft_wide_ascii_run(s + i, limit - m[k]);
+		i += run;
+		m[0] += run;
+		m[1] += run;
+		cost[0] = ft_utf8_len(s[i]);
+		cost[1] = ft_wcwidth(s[i]);
+		if (!s[i] || m[k] + cost[k] > limit)
+			break ;
+		m[0] += cost[0];
+		m[1] += cost[1];
+		i++;
+	}
+	return (i);
+}
+
+static void	ft_wide_emit(t_sink *out, const wchar_t *s, size_t n)
+{
+	char	buf[FT_WIDE_CHUNK];
+	size_t	pos;
+	size_t	run;
+
+	pos = 0;
+	while (n > 0)
+	{
+		if (pos > FT_WIDE_CHUNK - 4)
+		{
+			ft_sink_write(out, buf, pos);
+			pos = 0;
+		}
+		run = FT_WIDE_CHUNK - pos;
+		if (run > n)
+			run = n;
+		run = ft_wide_ascii_run(s, run);
+		ft_wide_narrow(s, run, buf + pos);
+		pos += run;
+		s += run;
+		n -= run;
+		if (run == 0 && n-- > 0)
+			pos += ft_utf8_encode(*s++, buf + pos);
+	}
+	ft_sink_write(out, buf, pos);
+}
+
+int	ft_print_wstr(t_sink *out, const wchar_t *s, t_fmt *spec)
+{
+	size_t	n;
+	int		m[2];
+	int		count;
+
+	if (!s)
+		return (ft_print_str(out, NULL, spec));
+	count = INT_MAX;
+	if (spec->precision >= 0)
+		count = spec->precision;
+	n = ft_wide_measure(s, count, spec->hash != 0, m);
+	count = m[0];
+	if (!spec->minus)
+		count += ft_print_padding(out, spec->width - m[spec->hash != 0], ' ');
+	ft_wide_emit(out, s, n);
+	if (spec->minus)
+		count += ft_print_padding(out, spec->width - m[spec->hash != 0], ' ');
+	return (count);
+}
+
+int	ft_print_wchar(t_sink *out, wint_t c, t_fmt *spec)
+{
+	char	buf[4];
+	int		len;
+	int		pad;
+	int		count;
+
+	len = ft_utf8_encode(c, buf);
+	pad = spec->width - len;
+	if (spec->hash)
+		pad = spec->width - ft_wcwidth(c);
+	count = 0;
+	if (!spec->minus)
+		count += ft_print_padding(out, pad, ' ');
+	count += ft_putnstr_count(out, buf, len);
+	if (spec->minus)
+		count += ft_print_padding(out, pad, ' ');
+	return (count);
+}
@@ -6,57 +6,93 @@
 /*   By: rmourey- <rmourey-@student.42madrid.com>   +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2026/01/27 12:30:00 by rmourey-          #+#    #+#             */
-/*   Updated: 2026/01/27 12:30:00 by rmourey-         ###   ########.fr       */
+/*   Updated: 2026/10/18 16:35:19 by rmourey-         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #include "ft_printf_bonus.h"
 
-static int	ft_dispatch(t_fmt *spec, va_list *args)
+static int	ft_dispatch(t_sink *out, t_fmt *spec, va_list *args)
 {
-	int	count;
+	t_arg	arg;
 
+	if (FT_PRINTF_STATS)
+		ft_stats_add(STAT_CONV + (spec->specifier & 127), 1);
+	ft_fetch_arg(spec, ft_arg_kind(spec), args, &arg);
+	return (ft_format_arg(out, spec, &arg));
+}
+
+/* Renders one item of the format, a literal run or a conversion, and
+   moves *i past it. */
+int	ft_vprintf_item(t_sink *out, const char *format, int *i, va_list *args)
+{
+	int		start;
+	int		count;
+	t_fmt	spec;
+
+	start = *i;
+	while (format[*i] && format[*i] != '%')
+		(*i)++;
+	if (*i > start)
+		return (ft_putnstr_count(out, format + start, *i - start));
 	count = 0;
-	if (spec->specifier == 'c')
-		count = ft_print_char((char)va_arg(*args, int), spec);
-	else if (spec->specifier == 's')
-		count = ft_print_str(va_arg(*args, char *), spec);
-	else if (spec->specifier == 'p')
-		count = ft_print_ptr(va_arg(*args, void *), spec);
-	else if (spec->specifier == 'd' || spec->specifier == 'i')
-		count = ft_print_nbr(va_arg(*args, int), spec);
-	else if (spec->specifier == 'u')
-		count = ft_print_unsigned(va_arg(*args, unsigned int), spec);
-	else if (spec->specifier == 'x' || spec->specifier == 'X')
-		count = ft_print_hex(va_arg(*args, unsigned int), spec);
-	else if (spec->specifier == '%')
-		count = ft_print_char('%', spec);
+	if (ft_parse_format(format, i, &spec))
+		count = ft_dispatch(out, &spec, args);
+	if (format[*i])
+		(*i)++;
 	return (count);
 }
 
-int	ft_printf(const char *format, ...)
+int	ft_vprintf_sink(t_sink *out, const char *format, va_list *args)
 {
-	va_list	args;
 	int		i;
 	int		count;
-	t_fmt	spec;
 
-	if (!format)
-		return (-1);
-	va_start(args, format);
 	i = 0;
 	count = 0;
 	while (format[i])
-	{
-		if (format[i] == '%')
-		{
-			if (ft_parse_format(format, &i, &spec))
-				count += ft_dispatch(&spec, &args);
-		}
-		else
-			count += ft_putchar_count(format[i]);
-		i++;
-	}
+		count += ft_vprintf_item(out, format, &i, args);
+	return (count);
+}
+
+int	ft_printf_sink(t_sink *out, const char *format, ...)
+{
+	va_list		args;
+	int			count;
+	long long	start;
+
+	if (!format)
+		return (-1);
+	start = 0;
+	if (FT_PRINTF_STATS)
+		start = ft_stats_now();
+	va_start(args, format);
+	count = ft_vprintf_sink(out, format, &args);
+	va_end(args);
+	if (FT_PRINTF_STATS)
+		ft_stats_call(start, count);
+	return (count);
+}
+
+int	ft_printf(const char *format, ...)
+{
+	va_list		args;
+	int			count;
+	t_sink		out;
+	long long	start;
+
+	if (!format)
+		return (-1);
+	start = 0;
+	if (FT_PRINTF_STATS)
+		start = ft_stats_now();
+	ft_sink_fd(&out, 1);
+	va_start(args, format);
+	count = ft_vprintf_sink(&out, format, &args);
 	va_end(args);
+	if (ft_sink_flush(&out) < 0)
+		count = -1;
+	if (FT_PRINTF_STATS)
+		ft_stats_call(start, count);
 	return (count);
 }
@@ -6,7 +6,7 @@
 /*   By: rmourey- <rmourey-@student.42madrid.com>   +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2026/01/27 12:07:22 by rmourey-          #+#    #+#             */
-/*   Updated: 2026/01/27 12:21:05 by rmourey-         ###   ########.fr       */
+/*   Updated: 2026/10/18 19:39:11 by rmourey-         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -14,7 +14,79 @@
 # define FT_PRINTF_BONUS_H
 
 # include "libft/libft.h"
+# include <limits.h>
 # include <stdarg.h>
+# include <stddef.h>
+# include <stdint.h>
+# include <time.h>
+# include <wchar.h>
+
+# ifndef FT_PRINTF_STATS
+#  define FT_PRINTF_STATS 0
+# endif
+
+# if FT_PRINTF_STATS
+#  define FT_STATS_SLOTS 64
+# else
+#  define FT_STATS_SLOTS 1
+# endif
+
+# ifdef __SIZEOF_INT128__
+#  define FT_HAS_INT128 1
+
+typedef __int128			t_wide;
+typedef unsigned __int128	t_uwide;
+# else
+#  define FT_HAS_INT128 0
+
+typedef long long			t_wide;
+typedef unsigned long long	t_uwide;
+# endif
+
+# define FT_U64_MAX 18446744073709551615ULL
+# define FT_WIDE_DIGITS 40
+# define FT_INT_BUF 130
+# define FT_FIXED_SCALE_MAX 64
+# define FT_HUMAN_SCALE_MAX 3
+# define FT_SINK_BUF 4096
+# define FT_PAD_CHUNK 64
+# define FT_POW5_INV_COUNT 342
+# define FT_POW5_COUNT 326
+# define FT_POW5_INV_BITS 125
+# define FT_POW5_BITS 125
+# define FT_DEC_DIGITS 800
+# define FT_BIG_LIMBS 96
+# define FT_WIDE_CHUNK 256
+# define FT_WC_RANGES 109
+# define FT_DUMP_CHUNK 128
+# define FT_DUMP_ASCII 60
+# define FT_B64_CHUNK 192
+# define FT_TABLE_COLS 32
+# define FT_STREAM_SMALL 256
+# define FT_BLOG_FMTS 128
+# define FT_BLOG_ARGS 16
+# define FT_BLOG_HEAD 7
+# define FT_BLOG_ALIGN 8
+# define FT_BLOG_NULL 0xFFFFFFFFU
+# define FT_TS_PREFIX 19
+# define FT_TS_MAX 40
+# define FT_TS_SEC_MIN -62167132800LL
+# define FT_TS_SEC_MAX 253402214399LL
+# define FT_STATS_CONVS 128
+# define FT_STATS_BUCKETS 64
+
+typedef enum e_len
+{
+	LEN_NONE,
+	LEN_HH,
+	LEN_H,
+	LEN_L,
+	LEN_LL,
+	LEN_Z,
+	LEN_J,
+	LEN_T,
+	LEN_128
+}	t_len;
 
 typedef struct s_fmt
 {
@@ -25,18 +97,350 @@ typedef struct s_fmt
 	int		plus;
 	int		width;
 	int		precision;
+	t_len	length;
 	char	specifier;
 }	t_fmt;
 
+typedef enum e_elem
+{
+	ELEM_INT,
+	ELEM_UINT,
+	ELEM_I64,
+	ELEM_U64
+}	t_elem;
+
+typedef struct s_col
+{
+	t_fmt		spec;
+	const char	*sep;
+	int			seplen;
+	t_elem		elem;
+	int			plain;
+}	t_col;
+
+typedef enum e_cell_kind
+{
+	CELL_STR,
+	CELL_INT,
+	CELL_UINT,
+	CELL_DOUBLE
+}	t_cell_kind;
+
+typedef struct s_cell
+{
+	t_cell_kind	kind;
+	const char	*s;
+	t_wide		i;
+	double		d;
+}	t_cell;
+
+typedef struct s_table
+{
+	t_fmt		specs[FT_TABLE_COLS];
+	int			widths[FT_TABLE_COLS];
+	size_t		cols;
+	const char	*sep;
+	int			seplen;
+}	t_table;
+
+typedef enum e_arg_kind
+{
+	ARG_NONE,
+	ARG_SIGNED,
+	ARG_UNSIGNED,
+	ARG_CHAR,
+	ARG_DOUBLE,
+	ARG_PTR,
+	ARG_TIME,
+	ARG_STR,
+	ARG_WSTR,
+	ARG_BYTES
+}	t_arg_kind;
+
+typedef struct s_arg
+{
+	t_wide		i;
+	double		d;
+	const void	*p;
+	size_t		n;
+}	t_arg;
+
+typedef struct s_num
+{
+	t_uwide	value;
+	int		base;
+	int		upper;
+	char	prefix[3];
+	char	buf[FT_INT_BUF];
+}	t_num;
+
+typedef struct s_sink
+{
+	int		fd;
+	char	*dst;
+	size_t	cap;
+	size_t	len;
+	size_t	used;
+	size_t	skip;
+	int		error;
+	char	buf[FT_SINK_BUF];
+}	t_sink;
+
+typedef enum e_stream_item
+{
+	STREAM_NONE,
+	STREAM_BYTES,
+	STREAM_REPLAY
+}	t_stream_item;
+
+/* i and args sit past the open item, whose argument was fetched once into
+   arg. Its output is pad[0] spaces, len bytes of src (small when src is
+   NULL), then pad[1] spaces; pos of those total bytes are delivered. */
+typedef struct s_stream
+{
+	const char		*format;
+	int				i;
+	va_list			args;
+	t_stream_item	open;
+	t_fmt			spec;
+	t_arg			arg;
+	const char		*src;
+	char			*heap;
+	size_t			pad[2];
+	size_t			len;
+	size_t			total;
+	size_t			pos;
+	char			small[FT_STREAM_SMALL];
+}	t_stream;
+
+typedef struct s_blog_sig
+{
+	unsigned char	kind;
+	unsigned char	length;
+	unsigned char	hash;
+	int				precision;
+}	t_blog_sig;
+
+typedef struct s_blog
+{
+	unsigned char	*buf;
+	size_t			cap;
+	size_t			len;
+	size_t			dropped;
+	const char		*fmts[FT_BLOG_FMTS];
+	size_t			text[FT_BLOG_FMTS];
+	int				nargs[FT_BLOG_FMTS];
+	t_blog_sig		sigs[FT_BLOG_FMTS][FT_BLOG_ARGS];
+}	t_blog;
+
+typedef struct s_cursor
+{
+	const unsigned char	*buf;
+	size_t				pos;
+	size_t				end;
+}	t_cursor;
+
+typedef enum e_stat
+{
+	STAT_CALLS,
+	STAT_BYTES,
+	STAT_WRITES,
+	STAT_FLUSHES,
+	STAT_SHORT,
+	STAT_CONV,
+	STAT_LATENCY = STAT_CONV + FT_STATS_CONVS,
+	STAT_COUNT = STAT_LATENCY + FT_STATS_BUCKETS
+}	t_stat;
+
+typedef struct s_stats_slot
+{
+	unsigned long long	v[STAT_COUNT];
+}	t_stats_slot;
+
+typedef struct s_printf_stats
+{
+	unsigned long long	calls;
+	unsigned long long	bytes;
+	unsigned long long	writes;
+	unsigned long long	flushes;
+	unsigned long long	short_writes;
+	unsigned long long	convs[FT_STATS_CONVS];
+	unsigned long long	latency[FT_STATS_BUCKETS];
+}	t_printf_stats;
+
+typedef struct s_tscache
+{
+	int			valid;
+	long long	sec;
+	char		prefix[FT_TS_PREFIX];
+	char		zone[8];
+	int			zlen;
+}	t_tscache;
+
+typedef struct s_ryu
+{
+	unsigned long long	m2;
+	unsigned long long	vr;
+	unsigned long long	vp;
+	unsigned long long	vm;
+	int					e2;
+	int					e10;
+	int					mmshift;
+	int					accept;
+	int					vm_tz;
+	int					vr_tz;
+	int					removed;
+	int					last;
+}	t_ryu;
+
+typedef struct s_dec
+{
+	char	digits[FT_DEC_DIGITS];
+	int		len;
+	int		exp;
+	int		neg;
+	char	style;
+}	t_dec;
+
 int		ft_printf(const char *format, ...);
+int		ft_printf_sink(t_sink *out, const char *format, ...);
+int		ft_vprintf_sink(t_sink *out, const char *format, va_list *args);
+int		ft_vprintf_item(t_sink *out, const char *format, int *i,
+			va_list *args);
+void	ft_stream_init(t_stream *st, const char *format, va_list *args);
+size_t	ft_stream_next(t_stream *st, char *window, size_t size);
+void	ft_stream_end(t_stream *st);
+int		ft_stream_open(t_stream *st);
+size_t	ft_stream_copy(t_stream *st, char *dst, size_t room);
+int		ft_snprintf(char *buf, size_t size, const char *format, ...);
+int		ft_vsnprintf(char *buf, size_t size, const char *format,
+			va_list *args);
+int		ft_printf_len(const char *format, ...);
+void	ft_blog_init(t_blog *log, void *buf, size_t cap);
+int		ft_blog(t_blog *log, const char *format, ...);
+int		ft_vblog(t_blog *log, const char *format, va_list *args);
+int		ft_blog_flush(t_blog *log, int fd);
+int		ft_blog_decode(t_sink *out, const void *data, size_t len);
+int		ft_blog_args(t_blog *log, int id, const char *format, va_list *args);
+int		ft_blog_sig(const char *format, t_blog_sig *sig);
+int		ft_blog_put(t_blog *log, const void *p, size_t n);
+int		ft_blog_head(t_blog *log, char tag, unsigned short id, uint32_t n);
+const unsigned char	*ft_blog_take(t_cursor *cur, size_t n);
+int		ft_blog_put_fixed(t_blog *log, t_arg_kind kind, const t_arg *arg,
+			int size);
+int		ft_blog_take_fixed(t_cursor *rd, t_fmt *spec, t_arg_kind kind,
+			t_arg *arg);
+void	ft_printf_stats(t_printf_stats *stats);
+void	ft_printf_stats_reset(void);
+void	ft_stats_add(t_stat stat, unsigned long long n);
+long long	ft_stats_now(void);
+void	ft_stats_call(long long start, int bytes);
+void	ft_stats_write(ssize_t ret, size_t n);
+int		ft_logkv(t_sink *out, ...);
+int		ft_logfmt(t_sink *out, ...);
+int		ft_vlogkv(t_sink *out, int json, va_list *args);
+t_cell	ft_kv_str(const char *s);
+t_cell	ft_kv_i64(int64_t v);
+t_cell	ft_kv_u64(uint64_t v);
+t_cell	ft_kv_f64(double v);
+int		ft_kv_key(t_sink *out, const char *key, int first, int json);
+int		ft_kv_value(t_sink *out, const t_cell *cell, int json);
+int		ft_col_init(t_col *col, const char *conv, const char *sep);
+size_t	ft_format_array(t_sink *out, const void *vals, size_t n, t_col *col);
+size_t	ft_format_int_array(t_sink *out, const int *vals, size_t n, t_col *col);
+size_t	ft_format_uint_array(t_sink *out, const unsigned int *vals, size_t n,
+			t_col *col);
+size_t	ft_format_i64_array(t_sink *out, const int64_t *vals, size_t n,
+			t_col *col);
+size_t	ft_format_u64_array(t_sink *out, const uint64_t *vals, size_t n,
+			t_col *col);
+size_t	ft_format_hex_array(t_sink *out, const uint64_t *vals, size_t n,
+			t_col *col);
+int		ft_table_init(t_table *table, size_t cols, const char *sep);
+int		ft_table_col(t_table *table, size_t c, const char *conv);
+size_t	ft_format_table(t_sink *out, const t_cell *cells, size_t rows,
+			t_table *table);
+int		ft_cell_width(const t_cell *cell, t_fmt *spec);
+int		ft_cell_emit(t_sink *out, const t_cell *cell, t_fmt *spec);
+void	ft_sink_fd(t_sink *out, int fd);
+void	ft_sink_mem(t_sink *out, char *dst, size_t cap);
+void	ft_sink_write(t_sink *out, const char *s, size_t n);
+int		ft_sink_flush(t_sink *out);
+int		ft_sink_discards(const t_sink *out);
 int		ft_parse_format(const char *fmt, int *i, t_fmt *spec);
-int		ft_print_char(char c, t_fmt *spec);
-int		ft_print_str(char *s, t_fmt *spec);
-int		ft_print_ptr(void *ptr, t_fmt *spec);
-int		ft_print_nbr(int n, t_fmt *spec);
-int		ft_print_unsigned(unsigned int n, t_fmt *spec);
-int		ft_print_hex(unsigned int n, t_fmt *spec);
-int		ft_putchar_count(char c);
-int		ft_print_padding(int n, char c);
+void	ft_parse_length(const char *fmt, int *i, t_fmt *spec);
+t_wide	ft_read_signed(t_fmt *spec, va_list *args);
+t_uwide	ft_read_unsigned(t_fmt *spec, va_list *args);
+t_arg_kind	ft_arg_kind(t_fmt *spec);
+void	ft_fetch_arg(t_fmt *spec, t_arg_kind kind, va_list *args,
+			t_arg *arg);
+int		ft_arg_size(t_fmt *spec, t_arg_kind kind);
+int		ft_print_char(t_sink *out, char c, t_fmt *spec);
+int		ft_print_str(t_sink *out, char *s, t_fmt *spec);
+int		ft_print_wchar(t_sink *out, wint_t c, t_fmt *spec);
+int		ft_print_wstr(t_sink *out, const wchar_t *s, t_fmt *spec);
+size_t	ft_wide_ascii_run(const wchar_t *s, size_t max);
+void	ft_wide_narrow(const wchar_t *s, size_t n, char *dst);
+int		ft_utf8_len(unsigned int c);
+int		ft_utf8_encode(unsigned int c, char *dst);
+int		ft_wcwidth(unsigned int c);
+int		ft_format_arg(t_sink *out, t_fmt *spec, const t_arg *arg);
+int		ft_print_time(t_sink *out, long long sec, long long ns, t_fmt *spec);
+void	ft_time_arg(const struct timespec *ts, t_arg *arg);
+void	ft_ts_digits(char *dst, long long v, int n);
+void	ft_ts_date(long long days, char *dst);
+int		ft_ts_zone(char *dst, long long off);
+int		ft_ts_frac(char *dst, unsigned int ns, int prec);
+int		ft_print_hexdump(t_sink *out, const void *p, size_t n, t_fmt *spec);
+int		ft_print_base64(t_sink *out, const unsigned char *p, size_t n,
+			t_fmt *spec);
+size_t	ft_b64_block(const unsigned char *p, size_t n, char *dst,
+			const char *abc);
+int		ft_print_escaped(t_sink *out, const char *s, t_fmt *spec);
+int		ft_escape_byte(unsigned char c, int cstyle);
+size_t	ft_escape_span(const char *s, size_t max, int cstyle);
+int		ft_print_ptr(t_sink *out, void *ptr, t_fmt *spec);
+int		ft_print_nbr(t_sink *out, t_wide n, t_fmt *spec);
+int		ft_print_unsigned(t_sink *out, t_uwide n, t_fmt *spec);
+int		ft_print_integer(t_sink *out, t_num *num, t_fmt *spec);
+int		ft_print_digits(t_sink *out, t_num *num, t_fmt *spec, int len);
+void	ft_signed_num(t_num *num, t_wide n, t_fmt *spec);
+int		ft_print_fixed(t_sink *out, t_wide n, t_fmt *spec);
+int		ft_fixed_body(t_num *num, int scale);
+int		ft_print_size(t_sink *out, t_uwide bytes, t_fmt *spec);
+int		ft_print_duration(t_sink *out, t_wide ns, t_fmt *spec);
+t_uwide	ft_upow10(int n);
+t_uwide	ft_scale_bin(t_uwide v, int shift, t_uwide pow);
+t_uwide	ft_scale_dec(t_uwide v, t_uwide div, t_uwide pow);
+void	ft_utoa_dec(t_uwide n, char *end);
+void	ft_utoa_hex(t_uwide n, char *end, int upper);
+void	ft_utoa_dec8(unsigned int v, char *out);
+void	ft_utoa_dec8x2(unsigned int a, unsigned int b, char *out);
+void	ft_utoa_oct(t_uwide n, char *end, int len);
+void	ft_utoa_bin(t_uwide n, char *end, int len);
+int		ft_print_float(t_sink *out, double v, t_fmt *spec);
+int		ft_print_hexfloat(t_sink *out, unsigned long long bits, char sign,
+			t_fmt *spec);
+int		ft_float_flen(t_dec *dec, t_fmt *spec);
+int		ft_float_elen(t_dec *dec, t_fmt *spec);
+int		ft_float_fbody(t_sink *out, t_dec *dec, t_fmt *spec);
+int		ft_float_ebody(t_sink *out, t_dec *dec, t_fmt *spec);
+void	ft_dtoa(double v, t_dec *dec, char style, int prec);
+void	ft_dtoa_shortest(unsigned long long bits, t_dec *dec);
+void	ft_dtoa_exact(unsigned long long bits, t_dec *dec);
+int		ft_dec_fast(t_dec *dec, int n);
+void	ft_dec_round(t_dec *dec, int n);
+void	ft_dec_trim(t_dec *dec, int n);
+void	ft_ryu_pos(t_ryu *r);
+void	ft_ryu_neg(t_ryu *r);
+void	ft_ryu_mul(t_ryu *r, const unsigned long long *mul, int j);
+int		ft_pow5_factor(unsigned long long v);
+const unsigned long long	*ft_pow5_inv_split(int i);
+const unsigned long long	*ft_pow5_split(int i);
+int		ft_uwide_declen(t_uwide n);
+int		ft_uwide_bitlen(t_uwide n);
+int		ft_putchar_count(t_sink *out, char c);
+int		ft_putnstr_count(t_sink *out, const char *s, int n);
+int		ft_print_padding(t_sink *out, int n, char c);
 
 #endif
@@ -0,0 +1,131 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_read_arg_bonus.c                                :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: rmourey- <rmourey-@student.42madrid.com>   +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 09:41:37 by rmourey-          #+#    #+#             */
+/*   Updated: 2026/10/18 19:09:38 by rmourey-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "ft_printf_bonus.h"
+
+t_wide	ft_read_signed(t_fmt *spec, va_list *args)
+{
+	if (spec->length == LEN_HH)
+		return ((signed char)va_arg(*args, int));
+	if (spec->length == LEN_H)
+		return ((short)va_arg(*args, int));
+	if (spec->length == LEN_L)
+		return (va_arg(*args, long));
+	if (spec->length == LEN_LL)
+		return (va_arg(*args, long long));
+	if (spec->length == LEN_Z)
+		return (va_arg(*args, ssize_t));
+	if (spec->length == LEN_J)
+		return (va_arg(*args, intmax_t));
+	if (spec->length == LEN_T)
+		return (va_arg(*args, ptrdiff_t));
+	if (spec->length == LEN_128)
+		return (va_arg(*args, t_wide));
+	return (va_arg(*args, int));
+}
+
+t_uwide	ft_read_unsigned(t_fmt *spec, va_list *args)
+{
+	if (spec->length == LEN_HH)
+		return ((unsigned char)va_arg(*args, unsigned int));
+	if (spec->length == LEN_H)
+		return ((unsigned short)va_arg(*args, unsigned int));
+	if (spec->length == LEN_L)
+		return (va_arg(*args, unsigned long));
+	if (spec->length == LEN_LL)
+		return (va_arg(*args, unsigned long long));
+	if (spec->length == LEN_Z)
+		return (va_arg(*args, size_t));
+	if (spec->length == LEN_J)
+		return (va_arg(*args, uintmax_t));
+	if (spec->length == LEN_T)
+		return ((size_t)va_arg(*args, ptrdiff_t));
+	if (spec->length == LEN_128)
+		return (va_arg(*args, t_uwide));
+	return (va_arg(*args, unsigned int));
+}
+
+/* How a conversion's argument is passed, and so how it is stored in a
+   binary log record. */
+t_arg_kind	ft_arg_kind(t_fmt *spec)
+{
+	char	c;
+
+	c = spec->specifier;
+	if (c == '%')
+		return (ARG_NONE);
+	if (ft_strchr("fFeEgGaA", c))
+		return (ARG_DOUBLE);
+	if (c == 'M' || c == 'R')
+		return (ARG_BYTES);
+	if (c == 'p')
+		return (ARG_PTR);
+	if (c == 'T')
+		return (ARG_TIME);
+	if (c == 's' && spec->length == LEN_L)
+		return (ARG_WSTR);
+	if (c == 's' || c == 'q')
+		return (ARG_STR);
+	if (c == 'c')
+		return (ARG_CHAR);
+	if (ft_strchr("dikN", c))
+		return (ARG_SIGNED);
+	return (ARG_UNSIGNED);
+}
+
+/* Reads the argument of a conversion of the given kind; only the length
+   modifier of spec is used. (pointer, length) pairs are read pointer
+   first: argument evaluation order is unspecified, so the two va_arg
+   calls stay in sequence. */
+void	ft_fetch_arg(t_fmt *spec, t_arg_kind kind, va_list *args,
+		t_arg *arg)
+{
+	if (kind == ARG_DOUBLE)
+		arg->d = va_arg(*args, double);
+	else if (kind == ARG_SIGNED)
+		arg->i = ft_read_signed(spec, args);
+	else if (kind == ARG_UNSIGNED)
+		arg->i = (t_wide)ft_read_unsigned(spec, args);
+	else if (kind == ARG_CHAR && spec->length == LEN_L)
+		arg->i = va_arg(*args, wint_t);
+	else if (kind == ARG_CHAR)
+		arg->i = va_arg(*args, int);
+	else if (kind == ARG_TIME)
+		ft_time_arg(va_arg(*args, const struct timespec *), arg);
+	else if (kind != ARG_NONE)
+		arg->p = va_arg(*args, const void *);
+	if (kind == ARG_BYTES)
+		arg->n = va_arg(*args, size_t);
+}
+
+/* Bytes a fixed-size argument takes in a binary log record: integers
+   keep the width their length modifier promotes to, a %T time is its
+   seconds and nanoseconds since the epoch, -1 for kinds whose size is
+   recorded with them. */
+int	ft_arg_size(t_fmt *spec, t_arg_kind kind)
+{
+	if (kind == ARG_NONE)
+		return (0);
+	if (kind == ARG_DOUBLE)
+		return (sizeof(double));
+	if (kind == ARG_PTR)
+		return (sizeof(void *));
+	if (kind >= ARG_STR)
+		return (-1);
+	if (kind == ARG_TIME)
+		return (sizeof(long long) + sizeof(int));
+	if (spec->length == LEN_128)
+		return (sizeof(t_wide));
+	if (kind == ARG_CHAR || spec->length < LEN_L)
+		return (sizeof(int));
+	return (sizeof(long long));
+}
@@ -0,0 +1,104 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_ryu_bonus.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: rmourey- <rmourey-@student.42madrid.com>   +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 12:15:56 by rmourey-          #+#    #+#             */
+/*   Updated: 2026/10/18 12:15:56 by rmourey-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "ft_printf_bonus.h"
+
+static void	ft_ryu_drop(t_ryu *r)
+{
+	r->last = r->vr % 10;
+	r->vr /= 10;
+	r->vp /= 10;
+	r->vm /= 10;
+	r->removed++;
+}
+
+static unsigned long long	ft_ryu_general(t_ryu *r)
+{
+	while (r->vp / 10 > r->vm / 10)
+	{
+		r->vm_tz &= (r->vm % 10 == 0);
+		r->vr_tz &= (r->last == 0);
+		ft_ryu_drop(r);
+	}
+	while (r->vm_tz && r->vm % 10 == 0)
+	{
+		r->vr_tz &= (r->last == 0);
+		ft_ryu_drop(r);
+	}
+	if (r->vr_tz && r->last == 5 && r->vr % 2 == 0)
+		r->last = 4;
+	return (r->vr + ((r->vr == r->vm && (!r->accept || !r->vm_tz))
+			|| r->last >= 5));
+}
+
+static unsigned long long	ft_ryu_common(t_ryu *r)
+{
+	int	round_up;
+
+	round_up = 0;
+	if (r->vp / 100 > r->vm / 100)
+	{
+		round_up = (r->vr % 100 >= 50);
+		r->vr /= 100;
+		r->vp /= 100;
+		r->vm /= 100;
+		r->removed += 2;
+	}
+	while (r->vp / 10 > r->vm / 10)
+	{
+		round_up = (r->vr % 10 >= 5);
+		ft_ryu_drop(r);
+	}
+	return (r->vr + (r->vr == r->vm || round_up));
+}
+
+static void	ft_ryu_init(t_ryu *r, unsigned long long bits)
+{
+	unsigned long long	mant;
+	int					expo;
+
+	mant = bits & ((1ULL << 52) - 1);
+	expo = (int)((bits >> 52) & 0x7ff);
+	r->e2 = expo - 1023 - 52 - 2;
+	r->m2 = mant | (1ULL << 52);
+	if (expo == 0)
+	{
+		r->e2 = 1 - 1023 - 52 - 2;
+		r->m2 = mant;
+	}
+	r->accept = ((r->m2 & 1) == 0);
+	r->mmshift = (mant != 0 || expo <= 1);
+	r->vm_tz = 0;
+	r->vr_tz = 0;
+	r->removed = 0;
+	r->last = 0;
+}
+
+void	ft_dtoa_shortest(unsigned long long bits, t_dec *dec)
+{
+	t_ryu				r;
+	unsigned long long	digits;
+
+	ft_ryu_init(&r, bits);
+	if (r.e2 >= 0)
+		ft_ryu_pos(&r);
+	else
+		ft_ryu_neg(&r);
+	if (r.vm_tz || r.vr_tz)
+		digits = ft_ryu_general(&r);
+	else
+		digits = ft_ryu_common(&r);
+	dec->len = ft_declen(digits);
+	ft_utoa_dec(digits, dec->digits + dec->len);
+	dec->exp = r.e10 + r.removed + dec->len - 1;
+	ft_dec_trim(dec, dec->len);
+}
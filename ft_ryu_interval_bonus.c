@@ -0,0 +1,69 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_ryu_interval_bonus.c                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: rmourey- <rmourey-@student.42madrid.com>   +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 12:12:39 by rmourey-          #+#    #+#             */
+/*   Updated: 2026/10/18 12:12:39 by rmourey-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "ft_printf_bonus.h"
+
+static int	ft_log10_pow2(int e)
+{
+	return ((int)(((unsigned int)e * 78913) >> 18));
+}
+
+static int	ft_log10_pow5(int e)
+{
+	return ((int)(((unsigned int)e * 732923) >> 20));
+}
+
+static int	ft_pow5bits(int e)
+{
+	return ((int)((((unsigned int)e * 1217359) >> 19) + 1));
+}
+
+void	ft_ryu_pos(t_ryu *r)
+{
+	int					q;
+	unsigned long long	mv;
+
+	q = ft_log10_pow2(r->e2) - (r->e2 > 3);
+	r->e10 = q;
+	ft_ryu_mul(r, ft_pow5_inv_split(q),
+		-r->e2 + q + FT_POW5_INV_BITS + ft_pow5bits(q) - 1);
+	if (q > 21)
+		return ;
+	mv = 4 * r->m2;
+	if (mv % 5 == 0)
+		r->vr_tz = (ft_pow5_factor(mv) >= q);
+	else if (r->accept)
+		r->vm_tz = (ft_pow5_factor(mv - 1 - r->mmshift) >= q);
+	else
+		r->vp -= (ft_pow5_factor(mv + 2) >= q);
+}
+
+void	ft_ryu_neg(t_ryu *r)
+{
+	int	q;
+	int	i;
+
+	q = ft_log10_pow5(-r->e2) - (-r->e2 > 1);
+	r->e10 = q + r->e2;
+	i = -r->e2 - q;
+	ft_ryu_mul(r, ft_pow5_split(i), q - (ft_pow5bits(i) - FT_POW5_BITS));
+	if (q <= 1)
+	{
+		r->vr_tz = 1;
+		if (r->accept)
+			r->vm_tz = (r->mmshift == 1);
+		else
+			r->vp--;
+	}
+	else if (q < 63)
+		r->vr_tz = ((4 * r->m2) & ((1ULL << q) - 1)) == 0;
+}
@@ -0,0 +1,79 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_ryu_math_bonus.c                                :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: rmourey- <rmourey-@student.42madrid.com>   +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 12:09:22 by rmourey-          #+#    #+#             */
+/*   Updated: 2026/10/18 12:09:22 by rmourey-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "ft_printf_bonus.h"
+
+#ifdef __SIZEOF_INT128__
+
+static unsigned long long	ft_mulshift64(unsigned long long m,
+		const unsigned long long *mul, int j)
+{
+	unsigned __int128	b0;
+	unsigned __int128	b2;
+
+	b0 = (unsigned __int128)m * mul[0];
+	b2 = (unsigned __int128)m * mul[1];
+	return ((unsigned long long)(((b0 >> 64) + b2) >> (j - 64)));
+}
+#else
+
+static unsigned long long	ft_umul128(unsigned long long a,
+		unsigned long long b, unsigned long long *hi)
+{
+	unsigned long long	lo_lo;
+	unsigned long long	hi_lo;
+	unsigned long long	lo_hi;
+	unsigned long long	mid;
+
+	lo_lo = (a & 0xffffffffULL) * (b & 0xffffffffULL);
+	hi_lo = (a >> 32) * (b & 0xffffffffULL);
+	lo_hi = (a & 0xffffffffULL) * (b >> 32);
+	mid = (lo_lo >> 32) + (hi_lo & 0xffffffffULL) + (lo_hi & 0xffffffffULL);
+	*hi = (a >> 32) * (b >> 32) + (hi_lo >> 32) + (lo_hi >> 32) + (mid >> 32);
+	return ((mid << 32) | (lo_lo & 0xffffffffULL));
+}
+
+static unsigned long long	ft_mulshift64(unsigned long long m,
+		const unsigned long long *mul, int j)
+{
+	unsigned long long	hi0;
+	unsigned long long	hi2;
+	unsigned long long	sum;
+
+	ft_umul128(m, mul[0], &hi0);
+	sum = ft_umul128(m, mul[1], &hi2) + hi0;
+	if (sum < hi0)
+		hi2++;
+	j -= 64;
+	return ((hi2 << (64 - j)) | (sum >> j));
+}
+#endif
+
+int	ft_pow5_factor(unsigned long long v)
+{
+	int	count;
+
+	count = 0;
+	while (v % 5 == 0)
+	{
+		v /= 5;
+		count++;
+	}
+	return (count);
+}
+
+void	ft_ryu_mul(t_ryu *r, const unsigned long long *mul, int j)
+{
+	r->vr = ft_mulshift64(4 * r->m2, mul, j);
+	r->vp = ft_mulshift64(4 * r->m2 + 2, mul, j);
+	r->vm = ft_mulshift64(4 * r->m2 - 1 - r->mmshift, mul, j);
+}
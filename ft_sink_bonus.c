@@ -0,0 +1,81 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_sink_bonus.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: rmourey- <rmourey-@student.42madrid.com>   +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 10:47:17 by rmourey-          #+#    #+#             */
+/*   Updated: 2026/10/18 16:41:53 by rmourey-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "ft_printf_bonus.h"
+
+static void	ft_sink_write_fd(t_sink *out, const char *s, size_t n)
+{
+	ssize_t	ret;
+
+	while (n > 0 && !out->error)
+	{
+		ret = write(out->fd, s, n);
+		if (FT_PRINTF_STATS)
+			ft_stats_write(ret, n);
+		if (ret < 0)
+			out->error = 1;
+		else
+		{
+			s += ret;
+			n -= ret;
+		}
+	}
+}
+
+int	ft_sink_flush(t_sink *out)
+{
+	if (FT_PRINTF_STATS && out->fd >= 0)
+		ft_stats_add(STAT_FLUSHES, 1);
+	if (out->fd >= 0 && out->used > 0)
+		ft_sink_write_fd(out, out->buf, out->used);
+	out->used = 0;
+	if (out->error)
+		return (-1);
+	return (0);
+}
+
+/* Stores the part of s that falls inside the window [skip, skip + cap)
+   of the logical output; everything else is only counted. */
+static void	ft_sink_store(t_sink *out, const char *s, size_t n)
+{
+	size_t	from;
+	size_t	room;
+
+	if (out->len + n <= out->skip || out->len >= out->skip + out->cap)
+		return ;
+	from = 0;
+	if (out->len < out->skip)
+		from = out->skip - out->len;
+	room = out->skip + out->cap - (out->len + from);
+	if (n - from < room)
+		room = n - from;
+	ft_memcpy(out->dst + out->len + from - out->skip, s + from, room);
+}
+
+void	ft_sink_write(t_sink *out, const char *s, size_t n)
+{
+	if (out->fd < 0)
+		ft_sink_store(out, s, n);
+	else
+	{
+		if (out->used + n > FT_SINK_BUF)
+			ft_sink_flush(out);
+		if (n > FT_SINK_BUF)
+			ft_sink_write_fd(out, s, n);
+		else
+		{
+			ft_memcpy(out->buf + out->used, s, n);
+			out->used += n;
+		}
+	}
+	out->len += n;
+}
@@ -0,0 +1,39 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_sink_init_bonus.c                               :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: rmourey- <rmourey-@student.42madrid.com>   +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 10:50:34 by rmourey-          #+#    #+#             */
+/*   Updated: 2026/10/18 15:09:57 by rmourey-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "ft_printf_bonus.h"
+
+void	ft_sink_fd(t_sink *out, int fd)
+{
+	out->fd = fd;
+	out->dst = NULL;
+	out->cap = 0;
+	out->len = 0;
+	out->used = 0;
+	out->skip = 0;
+	out->error = 0;
+}
+
+void	ft_sink_mem(t_sink *out, char *dst, size_t cap)
+{
+	ft_sink_fd(out, -1);
+	out->dst = dst;
+	out->cap = cap;
+}
+
+/* True when nothing more will be stored: a memory sink that is full, or
+   one with no room at all (pure length measurement). Handlers use it to
+   skip rendering work whose bytes would be dropped anyway. */
+int	ft_sink_discards(const t_sink *out)
+{
+	return (out->fd < 0 && out->len >= out->skip + out->cap);
+}
@@ -0,0 +1,61 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_snprintf_bonus.c                                :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: rmourey- <rmourey-@student.42madrid.com>   +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 14:40:24 by rmourey-          #+#    #+#             */
+/*   Updated: 2026/10/18 16:38:36 by rmourey-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "ft_printf_bonus.h"
+
+int	ft_vsnprintf(char *buf, size_t size, const char *format, va_list *args)
+{
+	t_sink		out;
+	int			count;
+	long long	start;
+
+	if (!format)
+		return (-1);
+	start = 0;
+	if (FT_PRINTF_STATS)
+		start = ft_stats_now();
+	if (!buf)
+		size = 0;
+	ft_sink_mem(&out, buf, size - (size > 0));
+	count = ft_vprintf_sink(&out, format, args);
+	if (size > 0 && out.len < out.cap)
+		buf[out.len] = '\0';
+	else if (size > 0)
+		buf[out.cap] = '\0';
+	if (FT_PRINTF_STATS)
+		ft_stats_call(start, count);
+	return (count);
+}
+
+int	ft_snprintf(char *buf, size_t size, const char *format, ...)
+{
+	va_list	args;
+	int		count;
+
+	va_start(args, format);
+	count = ft_vsnprintf(buf, size, format, &args);
+	va_end(args);
+	return (count);
+}
+
+/* Exact length ft_printf would write, computed without storing output:
+   integer digits, padding and string bodies are only counted. */
+int	ft_printf_len(const char *format, ...)
+{
+	va_list	args;
+	int		count;
+
+	va_start(args, format);
+	count = ft_vsnprintf(NULL, 0, format, &args);
+	va_end(args);
+	return (count);
+}
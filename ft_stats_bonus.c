@@ -0,0 +1,91 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_stats_bonus.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: rmourey- <rmourey-@student.42madrid.com>   +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 16:25:28 by rmourey-          #+#    #+#             */
+/*   Updated: 2026/10/18 16:25:28 by rmourey-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "ft_printf_bonus.h"
+
+static t_stats_slot			g_stats_slots[FT_STATS_SLOTS];
+static unsigned int			g_stats_next;
+static __thread t_stats_slot	*g_stats_mine;
+
+/* Each thread claims a slot on first use and is its only writer, so its
+   counters need no atomic read-modify-write. Threads past the table all
+   share the last slot, which is updated atomically. */
+static t_stats_slot	*ft_stats_slot(void)
+{
+	unsigned int	n;
+
+	if (!g_stats_mine)
+	{
+		n = __atomic_fetch_add(&g_stats_next, 1, __ATOMIC_RELAXED);
+		if (n >= FT_STATS_SLOTS)
+			n = FT_STATS_SLOTS - 1;
+		g_stats_mine = &g_stats_slots[n];
+	}
+	return (g_stats_mine);
+}
+
+/* Relaxed loads and stores: readers on other threads see whole values,
+   and the owner's update compiles to a plain add. */
+void	ft_stats_add(t_stat stat, unsigned long long n)
+{
+	t_stats_slot		*slot;
+	unsigned long long	*c;
+
+	slot = ft_stats_slot();
+	c = &slot->v[stat];
+	if (slot == &g_stats_slots[FT_STATS_SLOTS - 1])
+		__atomic_fetch_add(c, n, __ATOMIC_RELAXED);
+	else
+		__atomic_store_n(c, __atomic_load_n(c, __ATOMIC_RELAXED) + n,
+			__ATOMIC_RELAXED);
+}
+
+/* Sums every slot. Counters keep the totals of threads that have exited.
+   All zero when the library is built without FT_PRINTF_STATS. */
+void	ft_printf_stats(t_printf_stats *stats)
+{
+	unsigned long long	sum[STAT_COUNT];
+	int					s;
+	int					k;
+
+	ft_bzero(sum, sizeof(sum));
+	s = -1;
+	while (++s < FT_STATS_SLOTS)
+	{
+		k = -1;
+		while (++k < STAT_COUNT)
+			sum[k] += __atomic_load_n(&g_stats_slots[s].v[k],
+					__ATOMIC_RELAXED);
+	}
+	stats->calls = sum[STAT_CALLS];
+	stats->bytes = sum[STAT_BYTES];
+	stats->writes = sum[STAT_WRITES];
+	stats->flushes = sum[STAT_FLUSHES];
+	stats->short_writes = sum[STAT_SHORT];
+	ft_memcpy(stats->convs, sum + STAT_CONV, sizeof(stats->convs));
+	ft_memcpy(stats->latency, sum + STAT_LATENCY, sizeof(stats->latency));
+}
+
+/* Not synchronised with writers: updates racing with it may survive. */
+void	ft_printf_stats_reset(void)
+{
+	int	s;
+	int	k;
+
+	s = -1;
+	while (++s < FT_STATS_SLOTS)
+	{
+		k = -1;
+		while (++k < STAT_COUNT)
+			__atomic_store_n(&g_stats_slots[s].v[k], 0, __ATOMIC_RELAXED);
+	}
+}
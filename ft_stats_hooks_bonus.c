@@ -0,0 +1,48 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_stats_hooks_bonus.c                             :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: rmourey- <rmourey-@student.42madrid.com>   +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 16:28:45 by rmourey-          #+#    #+#             */
+/*   Updated: 2026/10/18 16:28:45 by rmourey-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "ft_printf_bonus.h"
+
+long long	ft_stats_now(void)
+{
+	struct timespec	ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ((long long)ts.tv_sec * 1000000000 + ts.tv_nsec);
+}
+
+/* One formatting call: its bytes, and its duration in a power-of-two
+   bucket (bucket k holds [2^(k-1), 2^k) nanoseconds). */
+void	ft_stats_call(long long start, int bytes)
+{
+	long long	ns;
+	int			k;
+
+	ft_stats_add(STAT_CALLS, 1);
+	if (bytes > 0)
+		ft_stats_add(STAT_BYTES, bytes);
+	ns = ft_stats_now() - start;
+	k = 0;
+	if (ns > 0)
+		k = 64 - __builtin_clzll((unsigned long long)ns);
+	if (k >= FT_STATS_BUCKETS)
+		k = FT_STATS_BUCKETS - 1;
+	ft_stats_add(STAT_LATENCY + k, 1);
+}
+
+/* One write(2) on an fd sink; short means some but not all bytes went. */
+void	ft_stats_write(ssize_t ret, size_t n)
+{
+	ft_stats_add(STAT_WRITES, 1);
+	if (ret >= 0 && (size_t)ret < n)
+		ft_stats_add(STAT_SHORT, 1);
+}
@@ -0,0 +1,50 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_stream_bonus.c                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: rmourey- <rmourey-@student.42madrid.com>   +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 14:56:49 by rmourey-          #+#    #+#             */
+/*   Updated: 2026/10/18 18:59:47 by rmourey-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "ft_printf_bonus.h"
+
+/* args must stay valid until ft_stream_end: call this from the variadic
+   function that owns them, or pass a va_copy. */
+void	ft_stream_init(t_stream *st, const char *format, va_list *args)
+{
+	st->format = format;
+	st->i = 0;
+	va_copy(st->args, *args);
+	st->open = STREAM_NONE;
+	st->heap = NULL;
+}
+
+/* Fills window with the next size bytes of output and returns how many
+   were written, 0 once the output is complete. Each item's argument is
+   fetched once. Items longer than FT_STREAM_SMALL are formatted twice,
+   once to measure and once into the heap, and again for each window
+   after a failed allocation. */
+size_t	ft_stream_next(t_stream *st, char *window, size_t size)
+{
+	size_t	n;
+
+	n = 0;
+	while (n < size && ft_stream_open(st))
+		n += ft_stream_copy(st, window + n, size - n);
+	return (n);
+}
+
+void	ft_stream_end(t_stream *st)
+{
+	if (!st->format)
+		return ;
+	free(st->heap);
+	st->heap = NULL;
+	st->open = STREAM_NONE;
+	va_end(st->args);
+	st->format = NULL;
+}
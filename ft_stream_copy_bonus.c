@@ -0,0 +1,60 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_stream_copy_bonus.c                             :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: rmourey- <rmourey-@student.42madrid.com>   +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 18:23:40 by rmourey-          #+#    #+#             */
+/*   Updated: 2026/10/18 18:23:40 by rmourey-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "ft_printf_bonus.h"
+
+static void	ft_stream_close(t_stream *st)
+{
+	free(st->heap);
+	st->heap = NULL;
+	st->open = STREAM_NONE;
+}
+
+/* Renders the item again into dst, with the bytes already delivered
+   skipped by the sink. */
+static void	ft_stream_replay(t_stream *st, char *dst, size_t room)
+{
+	t_sink	out;
+
+	ft_sink_mem(&out, dst, room);
+	out.skip = st->pos;
+	ft_format_arg(&out, &st->spec, &st->arg);
+}
+
+/* Copies the next bytes of the open item, at most room, and closes the
+   item once it is fully delivered. */
+size_t	ft_stream_copy(t_stream *st, char *dst, size_t room)
+{
+	size_t	end;
+	size_t	n;
+
+	end = st->pad[0];
+	if (st->pos >= end)
+		end += st->len;
+	if (st->pos >= end || st->open == STREAM_REPLAY)
+		end = st->total;
+	n = end - st->pos;
+	if (n > room)
+		n = room;
+	if (st->open == STREAM_REPLAY)
+		ft_stream_replay(st, dst, n);
+	else if (st->pos < st->pad[0] || st->pos >= st->pad[0] + st->len)
+		ft_memset(dst, ' ', n);
+	else if (st->src)
+		ft_memcpy(dst, st->src + (st->pos - st->pad[0]), n);
+	else
+		ft_memcpy(dst, st->small + (st->pos - st->pad[0]), n);
+	st->pos += n;
+	if (st->pos == st->total)
+		ft_stream_close(st);
+	return (n);
+}
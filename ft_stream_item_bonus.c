@@ -0,0 +1,112 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_stream_item_bonus.c                             :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: rmourey- <rmourey-@student.42madrid.com>   +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 18:13:49 by rmourey-          #+#    #+#             */
+/*   Updated: 2026/10/18 18:56:30 by rmourey-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "ft_printf_bonus.h"
+
+/* A plain %s is delivered straight from the argument: only its length is
+   measured, once, and the padding is emitted by count. */
+static void	ft_stream_str(t_stream *st)
+{
+	size_t	max;
+	size_t	pad;
+
+	st->src = st->arg.p;
+	if (!st->src)
+		st->src = "(null)";
+	max = INT_MAX;
+	if (st->spec.precision >= 0)
+		max = st->spec.precision;
+	st->len = ft_strnlen(st->src, max);
+	pad = 0;
+	if (st->spec.width > 0 && (size_t)st->spec.width > st->len)
+		pad = st->spec.width - st->len;
+	st->pad[st->spec.minus != 0] = pad;
+}
+
+/* Any other conversion is rendered into small. Longer output is only
+   measured by that pass and rendered a second time into a heap buffer of
+   its exact size. Without memory it falls back to rendering again for
+   each window from the saved argument. */
+static void	ft_stream_render(t_stream *st)
+{
+	t_sink	out;
+
+	ft_sink_mem(&out, st->small, FT_STREAM_SMALL);
+	ft_format_arg(&out, &st->spec, &st->arg);
+	st->len = out.len;
+	if (st->len <= FT_STREAM_SMALL)
+		return ;
+	st->heap = malloc(st->len);
+	st->src = st->heap;
+	if (!st->heap)
+	{
+		st->open = STREAM_REPLAY;
+		return ;
+	}
+	ft_sink_mem(&out, st->heap, st->len);
+	ft_format_arg(&out, &st->spec, &st->arg);
+}
+
+static void	ft_stream_conv(t_stream *st)
+{
+	if (!ft_parse_format(st->format, &st->i, &st->spec))
+		return ;
+	if (FT_PRINTF_STATS)
+		ft_stats_add(STAT_CONV + (st->spec.specifier & 127), 1);
+	ft_fetch_arg(&st->spec, ft_arg_kind(&st->spec), &st->args, &st->arg);
+	st->open = STREAM_BYTES;
+	if (st->spec.specifier == 's' && st->spec.length != LEN_L)
+		ft_stream_str(st);
+	else
+		ft_stream_render(st);
+}
+
+/* Reads the next literal run or conversion of the format, as
+   ft_vprintf_item does, and fetches its argument. */
+static void	ft_stream_item(t_stream *st)
+{
+	int	start;
+
+	st->src = NULL;
+	st->pad[0] = 0;
+	st->pad[1] = 0;
+	st->pos = 0;
+	start = st->i;
+	while (st->format[st->i] && st->format[st->i] != '%')
+		st->i++;
+	if (st->i > start)
+	{
+		st->src = st->format + start;
+		st->len = st->i - start;
+		st->open = STREAM_BYTES;
+	}
+	else
+	{
+		ft_stream_conv(st);
+		if (st->format[st->i])
+			st->i++;
+	}
+	st->total = st->pad[0] + st->len + st->pad[1];
+}
+
+/* Makes sure an item with bytes left is open; 0 once the format is
+   exhausted. Empty items (%.0s, invalid conversions) are skipped. */
+int	ft_stream_open(t_stream *st)
+{
+	while (st->open == STREAM_NONE && st->format && st->format[st->i])
+	{
+		ft_stream_item(st);
+		if (st->open != STREAM_NONE && st->total == 0)
+			st->open = STREAM_NONE;
+	}
+	return (st->open != STREAM_NONE);
+}
@@ -0,0 +1,105 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_table_bonus.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: rmourey- <rmourey-@student.42madrid.com>   +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 14:33:50 by rmourey-          #+#    #+#             */
+/*   Updated: 2026/10/18 18:07:15 by rmourey-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "ft_printf_bonus.h"
+
+/* Returns 0 when cols is above FT_TABLE_COLS; the table then has no
+   columns and ft_format_table writes nothing. */
+int	ft_table_init(t_table *table, size_t cols, const char *sep)
+{
+	if (cols > FT_TABLE_COLS)
+	{
+		table->cols = 0;
+		return (0);
+	}
+	table->cols = cols;
+	table->sep = sep;
+	table->seplen = ft_strlen(sep);
+	return (1);
+}
+
+int	ft_table_col(t_table *table, size_t c, const char *conv)
+{
+	int		i;
+	t_fmt	*sp;
+
+	i = 0;
+	if (c >= table->cols)
+		return (0);
+	sp = &table->specs[c];
+	if (conv[0] != '%' || !ft_parse_format(conv, &i, sp)
+		|| !ft_strchr("sdiuxXobBfFeEgGaA", sp->specifier)
+		|| conv[i + 1] != '\0')
+		return (0);
+	return (1);
+}
+
+static void	ft_table_measure(const t_cell *cells, size_t rows, t_table *table)
+{
+	size_t	r;
+	size_t	c;
+	int		w;
+
+	c = 0;
+	while (c < table->cols)
+	{
+		table->widths[c] = table->specs[c].width;
+		r = 0;
+		while (r < rows)
+		{
+			w = ft_cell_width(&cells[r * table->cols + c], &table->specs[c]);
+			if (w > table->widths[c])
+				table->widths[c] = w;
+			r++;
+		}
+		c++;
+	}
+}
+
+static void	ft_table_row(t_sink *out, const t_cell *row, t_table *table)
+{
+	t_fmt	sp;
+	size_t	c;
+
+	c = 0;
+	while (c < table->cols)
+	{
+		if (c > 0)
+			ft_putnstr_count(out, table->sep, table->seplen);
+		sp = table->specs[c];
+		sp.width = table->widths[c];
+		if (sp.minus && c + 1 == table->cols)
+			sp.width = 0;
+		ft_cell_emit(out, &row[c], &sp);
+		c++;
+	}
+	ft_putchar_count(out, '\n');
+}
+
+size_t	ft_format_table(t_sink *out, const t_cell *cells, size_t rows,
+			t_table *table)
+{
+	size_t	start;
+	size_t	r;
+
+	if (table->cols == 0)
+		return (0);
+	ft_table_measure(cells, rows, table);
+	start = out->len;
+	r = 0;
+	while (r < rows)
+	{
+		ft_table_row(out, &cells[r * table->cols], table);
+		r++;
+	}
+	return (out->len - start);
+}
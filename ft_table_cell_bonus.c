@@ -0,0 +1,64 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_table_cell_bonus.c                              :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: rmourey- <rmourey-@student.42madrid.com>   +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 14:30:33 by rmourey-          #+#    #+#             */
+/*   Updated: 2026/10/18 14:30:33 by rmourey-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "ft_printf_bonus.h"
+
+static int	ft_cell_intlen(t_wide v, t_fmt *spec)
+{
+	t_uwide	mag;
+	int		len;
+
+	mag = (t_uwide)v;
+	if (spec->specifier != 'u' && v < 0)
+		mag = -(t_uwide)v;
+	len = ft_uwide_declen(mag);
+	if (spec->precision > len)
+		len = spec->precision;
+	if (spec->precision == 0 && mag == 0)
+		len = 0;
+	if (spec->specifier != 'u' && (v < 0 || spec->plus || spec->space))
+		len++;
+	return (len);
+}
+
+/* Width of a cell rendered without padding. Strings and plain decimal
+   integers are measured directly; everything else is formatted into a
+   sink with no storage, which only counts. */
+int	ft_cell_width(const t_cell *cell, t_fmt *spec)
+{
+	t_sink	counter;
+	t_fmt	sp;
+
+	sp = *spec;
+	sp.width = 0;
+	if (cell->kind == CELL_STR && cell->s && sp.precision >= 0)
+		return ((int)ft_strnlen(cell->s, sp.precision));
+	if (cell->kind == CELL_STR && cell->s)
+		return ((int)ft_strnlen(cell->s, INT_MAX));
+	if (cell->kind == CELL_INT && ft_strchr("diu", sp.specifier)
+		&& !sp.hash)
+		return (ft_cell_intlen(cell->i, &sp));
+	ft_sink_mem(&counter, NULL, 0);
+	return (ft_cell_emit(&counter, cell, &sp));
+}
+
+int	ft_cell_emit(t_sink *out, const t_cell *cell, t_fmt *spec)
+{
+	if (cell->kind == CELL_STR)
+		return (ft_print_str(out, (char *)cell->s, spec));
+	if (cell->kind == CELL_DOUBLE)
+		return (ft_print_float(out, cell->d, spec));
+	if (cell->kind == CELL_INT
+		&& (spec->specifier == 'd' || spec->specifier == 'i'))
+		return (ft_print_nbr(out, cell->i, spec));
+	return (ft_print_unsigned(out, (t_uwide)cell->i, spec));
+}
@@ -0,0 +1,85 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_time_fmt_bonus.c                                :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: rmourey- <rmourey-@student.42madrid.com>   +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 15:59:12 by rmourey-          #+#    #+#             */
+/*   Updated: 2026/10/18 15:59:12 by rmourey-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "ft_printf_bonus.h"
+
+static const unsigned int	g_ts_pow10[10] = {1, 10, 100, 1000, 10000,
+	100000, 1000000, 10000000, 100000000, 1000000000};
+
+/* Writes the last n decimal digits of v, zero-padded. */
+void	ft_ts_digits(char *dst, long long v, int n)
+{
+	while (n-- > 0)
+	{
+		dst[n] = '0' + v % 10;
+		v /= 10;
+	}
+}
+
+/* Days since 1970-01-01 to YYYY-MM-DD in the proleptic Gregorian
+   calendar, counted in 400-year eras so no table or loop is needed. */
+void	ft_ts_date(long long days, char *dst)
+{
+	long long	era;
+	long long	doe;
+	long long	yoe;
+	long long	doy;
+	long long	mp;
+
+	days += 719468;
+	era = days / 146097 - (days % 146097 < 0);
+	doe = days - era * 146097;
+	yoe = (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365;
+	doy = doe - (365 * yoe + yoe / 4 - yoe / 100);
+	mp = (5 * doy + 2) / 153;
+	ft_ts_digits(dst + 8, doy - (153 * mp + 2) / 5 + 1, 2);
+	mp += 3 - 12 * (mp >= 10);
+	ft_ts_digits(dst + 5, mp, 2);
+	ft_ts_digits(dst, yoe + era * 400 + (mp <= 2), 4);
+	dst[4] = '-';
+	dst[7] = '-';
+}
+
+/* UTC offset in seconds as +hh:mm, or Z for UTC itself. */
+int	ft_ts_zone(char *dst, long long off)
+{
+	if (off == 0)
+	{
+		dst[0] = 'Z';
+		return (1);
+	}
+	dst[0] = '+';
+	if (off < 0)
+	{
+		dst[0] = '-';
+		off = -off;
+	}
+	ft_ts_digits(dst + 1, off / 3600, 2);
+	dst[3] = ':';
+	ft_ts_digits(dst + 4, off / 60 % 60, 2);
+	return (6);
+}
+
+/* The fraction of a second to prec digits (6 by default, at most 9),
+   truncated like the clock it comes from. */
+int	ft_ts_frac(char *dst, unsigned int ns, int prec)
+{
+	if (prec < 0)
+		prec = 6;
+	if (prec > 9)
+		prec = 9;
+	if (prec == 0)
+		return (0);
+	dst[0] = '.';
+	ft_ts_digits(dst + 1, ns / g_ts_pow10[9 - prec], prec);
+	return (prec + 1);
+}
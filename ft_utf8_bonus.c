@@ -0,0 +1,48 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_utf8_bonus.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: rmourey- <rmourey-@student.42madrid.com>   +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 13:18:19 by rmourey-          #+#    #+#             */
+/*   Updated: 2026/10/18 13:18:19 by rmourey-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "ft_printf_bonus.h"
+
+static unsigned int	ft_utf8_valid(unsigned int c)
+{
+	if (c > 0x10FFFF || (c >= 0xD800 && c <= 0xDFFF))
+		return (0xFFFD);
+	return (c);
+}
+
+int	ft_utf8_len(unsigned int c)
+{
+	c = ft_utf8_valid(c);
+	return (1 + (c >= 0x80) + (c >= 0x800) + (c >= 0x10000));
+}
+
+int	ft_utf8_encode(unsigned int c, char *dst)
+{
+	int	len;
+	int	i;
+
+	c = ft_utf8_valid(c);
+	len = ft_utf8_len(c);
+	if (len == 1)
+	{
+		dst[0] = (char)c;
+		return (1);
+	}
+	i = len;
+	while (--i > 0)
+	{
+		dst[i] = (char)(0x80 | (c & 0x3F));
+		c >>= 6;
+	}
+	dst[0] = (char)(((0xFF00 >> len) & 0xFF) | c);
+	return (len);
+}
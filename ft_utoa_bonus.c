@@ -0,0 +1,74 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_utoa_bonus.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: rmourey- <rmourey-@student.42madrid.com>   +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 09:44:54 by rmourey-          #+#    #+#             */
+/*   Updated: 2026/10/18 09:44:54 by rmourey-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "ft_printf_bonus.h"
+
+static const char	g_digit_pairs[201]
+	= "00010203040506070809101112131415161718192021222324"
+	"25262728293031323334353637383940414243444546474849"
+	"50515253545556575859606162636465666768697071727374"
+	"75767778798081828384858687888990919293949596979899";
+
+static void	ft_put_pair(unsigned int v, char *end)
+{
+	*(end - 2) = g_digit_pairs[v * 2];
+	*(end - 1) = g_digit_pairs[v * 2 + 1];
+}
+
+static void	ft_put8(unsigned int v, char *end)
+{
+	unsigned int	hi;
+	unsigned int	lo;
+
+	hi = v / 10000;
+	lo = v % 10000;
+	ft_put_pair(lo % 100, end);
+	ft_put_pair(lo / 100, end - 2);
+	ft_put_pair(hi % 100, end - 4);
+	ft_put_pair(hi / 100, end - 6);
+}
+
+static void	ft_put32(unsigned int v, char *end)
+{
+	while (v >= 100)
+	{
+		ft_put_pair(v % 100, end);
+		v /= 100;
+		end -= 2;
+	}
+	if (v >= 10)
+		ft_put_pair(v, end);
+	else
+		*(end - 1) = '0' + v;
+}
+
+void	ft_utoa_dec(t_uwide n, char *end)
+{
+	unsigned long long	low;
+
+	while (n > FT_U64_MAX)
+	{
+		low = (unsigned long long)(n % 10000000000000000ULL);
+		ft_put8((unsigned int)(low % 100000000), end);
+		ft_put8((unsigned int)(low / 100000000), end - 8);
+		n /= 10000000000000000ULL;
+		end -= 16;
+	}
+	low = (unsigned long long)n;
+	while (low >= 100000000)
+	{
+		ft_put8((unsigned int)(low % 100000000), end);
+		low /= 100000000;
+		end -= 8;
+	}
+	ft_put32((unsigned int)low, end);
+}
@@ -0,0 +1,67 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_utoa_dec8_bonus.c                               :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: rmourey- <rmourey-@student.42madrid.com>   +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 10:53:51 by rmourey-          #+#    #+#             */
+/*   Updated: 2026/10/18 17:47:33 by rmourey-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "ft_printf_bonus.h"
+
+#ifdef __SSE2__
+# include <emmintrin.h>
+
+static __m128i	ft_dec8_lanes(unsigned int v)
+{
+	__m128i	quads;
+	__m128i	prefixes;
+	int		hi;
+	int		lo;
+
+	hi = (v / 10000) << 2;
+	lo = (v % 10000) << 2;
+	quads = _mm_set_epi16(lo, lo, lo, lo, hi, hi, hi, hi);
+	prefixes = _mm_mulhi_epu16(_mm_mulhi_epu16(quads,
+				_mm_set_epi16(-32768, 13108, 5243, 8389,
+					-32768, 13108, 5243, 8389)),
+			_mm_set_epi16(-32768, 1 << 13, 1 << 11, 1 << 7,
+				-32768, 1 << 13, 1 << 11, 1 << 7));
+	return (_mm_sub_epi16(prefixes, _mm_slli_epi64(
+				_mm_mullo_epi16(prefixes, _mm_set1_epi16(10)), 16)));
+}
+
+void	ft_utoa_dec8(unsigned int v, char *out)
+{
+	_mm_storel_epi64((__m128i *)out, _mm_add_epi8(_mm_packus_epi16(
+				ft_dec8_lanes(v), _mm_setzero_si128()), _mm_set1_epi8('0')));
+}
+
+void	ft_utoa_dec8x2(unsigned int a, unsigned int b, char *out)
+{
+	_mm_storeu_si128((__m128i *)out, _mm_add_epi8(_mm_packus_epi16(
+				ft_dec8_lanes(a), ft_dec8_lanes(b)), _mm_set1_epi8('0')));
+}
+#else
+
+void	ft_utoa_dec8(unsigned int v, char *out)
+{
+	int	i;
+
+	i = 8;
+	while (i-- > 0)
+	{
+		out[i] = '0' + v % 10;
+		v /= 10;
+	}
+}
+
+void	ft_utoa_dec8x2(unsigned int a, unsigned int b, char *out)
+{
+	ft_utoa_dec8(a, out);
+	ft_utoa_dec8(b, out + 8);
+}
+#endif
@@ -0,0 +1,71 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_utoa_hex_bonus.c                                :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: rmourey- <rmourey-@student.42madrid.com>   +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 10:14:27 by rmourey-          #+#    #+#             */
+/*   Updated: 2026/10/18 10:14:27 by rmourey-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "ft_printf_bonus.h"
+
+static void	ft_hex16_scalar(unsigned long long n, char *end, const char *digits)
+{
+	int	i;
+
+	i = 0;
+	while (i < 16)
+	{
+		*(--end) = digits[n & 15];
+		n >>= 4;
+		i++;
+	}
+}
+
+#ifdef __x86_64__
+# include <tmmintrin.h>
+
+__attribute__((target("ssse3")))
+static void	ft_hex16_ssse3(unsigned long long n, char *end, const char *digits)
+{
+	__m128i	bytes;
+	__m128i	mask;
+	__m128i	nibbles;
+
+	bytes = _mm_cvtsi64_si128((long long)__builtin_bswap64(n));
+	mask = _mm_set1_epi8(0x0f);
+	nibbles = _mm_unpacklo_epi8(_mm_and_si128(_mm_srli_epi64(bytes, 4), mask),
+			_mm_and_si128(bytes, mask));
+	_mm_storeu_si128((__m128i *)(end - 16), _mm_shuffle_epi8(
+			_mm_loadu_si128((const __m128i *)digits), nibbles));
+}
+
+static void	ft_hex16(unsigned long long n, char *end, const char *digits)
+{
+	if (__builtin_cpu_supports("ssse3"))
+		ft_hex16_ssse3(n, end, digits);
+	else
+		ft_hex16_scalar(n, end, digits);
+}
+#else
+
+static void	ft_hex16(unsigned long long n, char *end, const char *digits)
+{
+	ft_hex16_scalar(n, end, digits);
+}
+#endif
+
+void	ft_utoa_hex(t_uwide n, char *end, int upper)
+{
+	const char	*digits;
+
+	digits = "0123456789abcdef";
+	if (upper)
+		digits = "0123456789ABCDEF";
+	ft_hex16((unsigned long long)n, end, digits);
+	if (n > FT_U64_MAX)
+		ft_hex16((unsigned long long)(n >> 32 >> 32), end - 16, digits);
+}
@@ -0,0 +1,31 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_utoa_pow2_bonus.c                               :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: rmourey- <rmourey-@student.42madrid.com>   +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 10:34:09 by rmourey-          #+#    #+#             */
+/*   Updated: 2026/10/18 10:34:09 by rmourey-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "ft_printf_bonus.h"
+
+void	ft_utoa_oct(t_uwide n, char *end, int len)
+{
+	while (len-- > 0)
+	{
+		*(--end) = '0' + (n & 7);
+		n >>= 3;
+	}
+}
+
+void	ft_utoa_bin(t_uwide n, char *end, int len)
+{
+	while (len-- > 0)
+	{
+		*(--end) = '0' + (n & 1);
+		n >>= 1;
+	}
+}
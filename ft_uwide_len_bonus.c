@@ -0,0 +1,33 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_uwide_len_bonus.c                               :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: rmourey- <rmourey-@student.42madrid.com>   +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 09:48:11 by rmourey-          #+#    #+#             */
+/*   Updated: 2026/10/18 09:48:11 by rmourey-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "ft_printf_bonus.h"
+
+int	ft_uwide_declen(t_uwide n)
+{
+	int	len;
+
+	len = 0;
+	while (n > FT_U64_MAX)
+	{
+		n /= 10000000000000000000ULL;
+		len += 19;
+	}
+	return (len + ft_declen((unsigned long long)n));
+}
+
+int	ft_uwide_bitlen(t_uwide n)
+{
+	if (n > FT_U64_MAX)
+		return (64 + ft_bitlen((unsigned long long)(n >> 32 >> 32)));
+	return (ft_bitlen((unsigned long long)n));
+}
@@ -0,0 +1,77 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_wcwidth_bonus.c                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: rmourey- <rmourey-@student.42madrid.com>   +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 13:21:36 by rmourey-          #+#    #+#             */
+/*   Updated: 2026/10/18 13:21:36 by rmourey-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "ft_printf_bonus.h"
+
+/* Code point ranges whose display width is not 1: combining marks and
+   format characters (0) and East Asian wide characters and emoji (2). */
+static const unsigned int	g_wc_ranges[FT_WC_RANGES][3] = {
+	{0x300, 0x36F, 0}, {0x483, 0x489, 0}, {0x591, 0x5BD, 0}, {0x5BF, 0x5BF, 0},
+	{0x5C1, 0x5C2, 0}, {0x5C4, 0x5C5, 0}, {0x5C7, 0x5C7, 0}, {0x610, 0x61A, 0},
+	{0x64B, 0x65F, 0}, {0x670, 0x670, 0}, {0x6D6, 0x6DC, 0}, {0x6DF, 0x6E4, 0},
+	{0x6E7, 0x6E8, 0}, {0x6EA, 0x6ED, 0}, {0x711, 0x711, 0}, {0x730, 0x74A, 0},
+	{0x7A6, 0x7B0, 0}, {0x816, 0x819, 0}, {0x900, 0x902, 0}, {0x93A, 0x93A, 0},
+	{0x93C, 0x93C, 0}, {0x941, 0x948, 0}, {0x94D, 0x94D, 0}, {0x951, 0x957, 0},
+	{0x962, 0x963, 0}, {0xE31, 0xE31, 0}, {0xE34, 0xE3A, 0}, {0xE47, 0xE4E, 0},
+	{0x1100, 0x115F, 2}, {0x1160, 0x11FF, 0}, {0x1AB0, 0x1AFF, 0},
+	{0x1DC0, 0x1DFF, 0}, {0x200B, 0x200F, 0}, {0x202A, 0x202E, 0},
+	{0x2060, 0x2064, 0}, {0x20D0, 0x20FF, 0}, {0x231A, 0x231B, 2},
+	{0x2329, 0x232A, 2}, {0x23E9, 0x23EC, 2}, {0x23F0, 0x23F0, 2},
+	{0x23F3, 0x23F3, 2}, {0x25FD, 0x25FE, 2}, {0x2614, 0x2615, 2},
+	{0x2648, 0x2653, 2}, {0x267F, 0x267F, 2}, {0x2693, 0x2693, 2},
+	{0x26A1, 0x26A1, 2}, {0x26AA, 0x26AB, 2}, {0x26BD, 0x26BE, 2},
+	{0x26C4, 0x26C5, 2}, {0x26CE, 0x26CE, 2}, {0x26D4, 0x26D4, 2},
+	{0x26EA, 0x26EA, 2}, {0x26F2, 0x26F3, 2}, {0x26F5, 0x26F5, 2},
+	{0x26FA, 0x26FA, 2}, {0x26FD, 0x26FD, 2}, {0x2705, 0x2705, 2},
+	{0x270A, 0x270B, 2}, {0x2728, 0x2728, 2}, {0x274C, 0x274C, 2},
+	{0x274E, 0x274E, 2}, {0x2753, 0x2755, 2}, {0x2757, 0x2757, 2},
+	{0x2795, 0x2797, 2}, {0x27B0, 0x27B0, 2}, {0x27BF, 0x27BF, 2},
+	{0x2B1B, 0x2B1C, 2}, {0x2B50, 0x2B50, 2}, {0x2B55, 0x2B55, 2},
+	{0x2E80, 0x3029, 2}, {0x302A, 0x302D, 0}, {0x302E, 0x303E, 2},
+	{0x3041, 0x3098, 2}, {0x3099, 0x309A, 0}, {0x309B, 0xA4CF, 2},
+	{0xA960, 0xA97F, 2}, {0xAC00, 0xD7A3, 2}, {0xF900, 0xFAFF, 2},
+	{0xFE00, 0xFE0F, 0}, {0xFE10, 0xFE19, 2}, {0xFE20, 0xFE2F, 0},
+	{0xFE30, 0xFE6F, 2}, {0xFEFF, 0xFEFF, 0}, {0xFF00, 0xFF60, 2},
+	{0xFFE0, 0xFFE6, 2}, {0x16FE0, 0x16FE4, 2}, {0x17000, 0x18CFF, 2},
+	{0x1B000, 0x1B2FF, 2}, {0x1F004, 0x1F004, 2}, {0x1F0CF, 0x1F0CF, 2},
+	{0x1F18E, 0x1F18E, 2}, {0x1F191, 0x1F19A, 2}, {0x1F200, 0x1F202, 2},
+	{0x1F210, 0x1F23B, 2}, {0x1F240, 0x1F248, 2}, {0x1F250, 0x1F251, 2},
+	{0x1F260, 0x1F265, 2}, {0x1F300, 0x1F3FA, 2}, {0x1F3FB, 0x1F3FF, 0},
+	{0x1F400, 0x1F64F, 2}, {0x1F680, 0x1F6FF, 2}, {0x1F7E0, 0x1F7EB, 2},
+	{0x1F90C, 0x1F9FF, 2}, {0x1FA70, 0x1FAFF, 2}, {0x20000, 0x2FFFD, 2},
+	{0x30000, 0x3FFFD, 2}, {0xE0001, 0xE007F, 0}, {0xE0100, 0xE01EF, 0}
+};
+
+int	ft_wcwidth(unsigned int c)
+{
+	int	lo;
+	int	hi;
+	int	mid;
+
+	if (c < 0x80)
+		return (1);
+	if (c < 0xA0)
+		return (0);
+	lo = 0;
+	hi = FT_WC_RANGES - 1;
+	while (lo <= hi)
+	{
+		mid = (lo + hi) / 2;
+		if (c < g_wc_ranges[mid][0])
+			hi = mid - 1;
+		else if (c > g_wc_ranges[mid][1])
+			lo = mid + 1;
+		else
+			return ((int)g_wc_ranges[mid][2]);
+	}
+	return (1);
+}
@@ -0,0 +1,93 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_wide_ascii_bonus.c                              :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: rmourey- <rmourey-@student.42madrid.com>   +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 13:24:53 by rmourey-          #+#    #+#             */
+/*   Updated: 2026/10/18 18:00:41 by rmourey-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "ft_printf_bonus.h"
+
+#if FT_SSE2_SCAN && __SIZEOF_WCHAR_T__ == 4
+# include <emmintrin.h>
+
+static int	ft_wide_block(const wchar_t *s)
+{
+	__m128i	v;
+
+	v = _mm_sub_epi32(_mm_load_si128((const __m128i *)s), _mm_set1_epi32(1));
+	return (_mm_movemask_epi8(_mm_or_si128(
+				_mm_cmplt_epi32(v, _mm_setzero_si128()),
+				_mm_cmpgt_epi32(v, _mm_set1_epi32(0x7E)))));
+}
+
+/* Length of the leading run of non-NUL ASCII characters, at most max.
+   Blocks are loaded aligned, so the scan never crosses into an unmapped
+   page past the terminator. */
+size_t	ft_wide_ascii_run(const wchar_t *s, size_t max)
+{
+	size_t	i;
+	int		mask;
+
+	i = 0;
+	while (i < max && ((uintptr_t)(s + i) & 15))
+	{
+		if ((unsigned int)s[i] - 1 >= 0x7F)
+			return (i);
+		i++;
+	}
+	while (i < max)
+	{
+		mask = ft_wide_block(s + i);
+		if (mask)
+		{
+			i += __builtin_ctz(mask) / 4;
+			break ;
+		}
+		i += 4;
+	}
+	if (i > max)
+		return (max);
+	return (i);
+}
+
+void	ft_wide_narrow(const wchar_t *s, size_t n, char *dst)
+{
+	__m128i	lo;
+	__m128i	hi;
+
+	while (n >= 8)
+	{
+		lo = _mm_loadu_si128((const __m128i *)s);
+		hi = _mm_loadu_si128((const __m128i *)(s + 4));
+		_mm_storel_epi64((__m128i *)dst, _mm_packus_epi16(
+				_mm_packs_epi32(lo, hi), _mm_setzero_si128()));
+		s += 8;
+		dst += 8;
+		n -= 8;
+	}
+	while (n-- > 0)
+		*dst++ = (char)*s++;
+}
+#else
+
+size_t	ft_wide_ascii_run(const wchar_t *s, size_t max)
+{
+	size_t	i;
+
+	i = 0;
+	while (i < max && (unsigned int)s[i] - 1 < 0x7F)
+		i++;
+	return (i);
+}
+
+void	ft_wide_narrow(const wchar_t *s, size_t n, char *dst)
+{
+	while (n-- > 0)
+		*dst++ = (char)*s++;
+}
+#endif
@@ -0,0 +1,161 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bench_libft.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: rmourey- <rmourey-@student.42madrid.com>   +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 16:48:27 by rmourey-          #+#    #+#             */
+/*   Updated: 2026/10/18 18:49:56 by rmourey-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "bench_libft.h"
+
+static const t_routine	g_routines[BENCH_ROUTINES] = {
+{"memcpy", run_memcpy, BENCH_MAX, "memcpy"},
+{"memmove", run_memmove, BENCH_MAX, "memmove"},
+{"memset", run_memset, BENCH_MAX, "memset"},
+{"bzero", run_bzero, BENCH_MAX, "bzero"},
+{"memchr", run_memchr, BENCH_MAX, "memchr"},
+{"memcmp", run_memcmp, BENCH_MAX, "memcmp"},
+{"calloc", run_calloc, BENCH_MAX, "calloc"},
+{"strlen", run_strlen, BENCH_MAX, "strlen"},
+{"strnlen", run_strnlen, BENCH_MAX, "strnlen"},
+{"strchr", run_strchr, BENCH_MAX, "strchr"},
+{"strrchr", run_strrchr, BENCH_MAX, "strrchr"},
+{"strncmp", run_strncmp, BENCH_MAX, "strncmp"},
+{"strlcpy", run_strlcpy, BENCH_MAX, NULL},
+{"strlcat", run_strlcat, BENCH_MAX, NULL},
+{"strnstr", run_strnstr, BENCH_MAX, "strstr"},
+{"strdup", run_strdup, BENCH_MAX, "strdup"},
+{"substr", run_substr, BENCH_MAX, "strndup"},
+{"strjoin", run_strjoin, BENCH_MAX, NULL},
+{"strtrim", run_strtrim, BENCH_MAX, NULL},
+{"strmapi", run_strmapi, BENCH_MAX, NULL},
+{"striteri", run_striteri, BENCH_MAX, NULL},
+{"ctype_is", run_ctype_is, BENCH_MAX, "is*"},
+{"ctype_to", run_ctype_to, BENCH_MAX, "to*"},
+{"split", run_split, 65536, NULL},
+{"atoi", run_atoi, 0, "atoi"},
+{"itoa", run_itoa, 0, "snprintf"}};
+
+static const size_t		g_sizes[BENCH_SIZES] = {8, 64, 512, 4096, 65536,
+	1048576, BENCH_MAX};
+
+static double	bench_now(void)
+{
+	struct timespec	ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (ts.tv_sec * 1e9 + ts.tv_nsec);
+}
+
+/* Fills both operands with n bytes of 'a' at the given misalignment and
+   terminates them; words holds n bytes of seven-letter words. */
+static void	bench_prepare(t_bench *b, size_t n, size_t align)
+{
+	size_t	i;
+
+	b->s = b->src + align;
+	b->d = b->dst + align + align / 2;
+	b->w = b->words + align;
+	memset(b->src, 'a', n + BENCH_PAD);
+	memset(b->dst, 'a', n + BENCH_PAD);
+	i = 0;
+	while (i++ < n + BENCH_PAD)
+		b->words[i - 1] = "aaaaaaa "[(i - 1) % 8];
+	b->s[n] = '\0';
+	b->d[n] = '\0';
+	b->w[n] = '\0';
+}
+
+/* Mean ns per call; the batch doubles until BENCH_MIN_NS have passed, so
+   slow and quadratic routines still finish in bounded time. */
+static double	bench_time(t_bench *b, const t_routine *r, size_t n, int libc)
+{
+	double	start;
+	double	now;
+	size_t	batch;
+	size_t	calls;
+	size_t	i;
+
+	b->sink += r->run(b, n, libc);
+	batch = 1;
+	calls = 0;
+	start = bench_now();
+	now = start;
+	while (now - start < BENCH_MIN_NS)
+	{
+		i = 0;
+		while (i++ < batch)
+			b->sink += r->run(b, n, libc);
+		calls += batch;
+		batch *= 2;
+		now = bench_now();
+	}
+	return ((now - start) / calls);
+}
+
+static void	bench_row(t_bench *b, const t_routine *r, size_t n, size_t align)
+{
+	double	ft;
+	double	lc;
+
+	bench_prepare(b, n, align);
+	ft = bench_time(b, r, n, 0);
+	lc = 0;
+	if (r->libc)
+	{
+		bench_prepare(b, n, align);
+		lc = bench_time(b, r, n, 1);
+	}
+	if (r->max)
+		printf("%-8s %9zu %5zu %12.1f %8.2f", r->name, n, align, ft, n / ft);
+	else
+		printf("%-8s %9s %5s %12.1f %8s", r->name, "-", "-", ft, "-");
+	if (r->libc && r->max)
+		printf(" %12.1f %8.2f %7.2fx", lc, n / lc, lc / ft);
+	else if (r->libc)
+		printf(" %12.1f %8s %7.2fx", lc, "-", lc / ft);
+	printf("\n");
+}
+
+static void	bench_routine(t_bench *b, const t_routine *r)
+{
+	size_t	i;
+
+	if (!r->max)
+		bench_row(b, r, 0, 0);
+	i = 0;
+	while (r->max && i < BENCH_SIZES * 2 && g_sizes[i / 2] <= r->max)
+	{
+		bench_row(b, r, g_sizes[i / 2], (i % 2) * 3);
+		i++;
+	}
+}
+
+/* usage: bench_libft [routine]; sizes run from 8 B to 16 MiB, each with
+   aligned and with misaligned operands. */
+int	main(int argc, char **argv)
+{
+	static t_bench	b;
+	size_t			k;
+
+	b.src = malloc(BENCH_MAX + 2 * BENCH_PAD);
+	b.dst = malloc(BENCH_MAX + 2 * BENCH_PAD);
+	b.words = malloc(BENCH_MAX + 2 * BENCH_PAD);
+	if (!b.src || !b.dst || !b.words)
+		return (1);
+	printf("%-8s %9s %5s %12s %8s %12s %8s %8s\n", "routine", "size",
+		"align", "ft ns", "ft GB/s", "libc ns", "lc GB/s", "speed");
+	k = -1;
+	while (++k < BENCH_ROUTINES)
+	{
+		if (argc < 2 || !strcmp(argv[1], g_routines[k].name))
+			bench_routine(&b, &g_routines[k]);
+	}
+	if (b.sink == 42)
+		printf("\n");
+	return (0);
+}
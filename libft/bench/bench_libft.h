@@ -0,0 +1,79 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bench_libft.h                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: rmourey- <rmourey-@student.42madrid.com>   +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 16:51:44 by rmourey-          #+#    #+#             */
+/*   Updated: 2026/10/18 18:46:39 by rmourey-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef BENCH_LIBFT_H
+# define BENCH_LIBFT_H
+
+# include "../libft.h"
+# include <ctype.h>
+# include <stdio.h>
+# include <string.h>
+# include <strings.h>
+# include <time.h>
+
+# define BENCH_MAX 16777216
+# define BENCH_PAD 64
+# define BENCH_MIN_NS 20000000.0
+# define BENCH_SIZES 7
+# define BENCH_ROUTINES 26
+
+typedef struct s_bench
+{
+	char	*src;
+	char	*dst;
+	char	*words;
+	char	*s;
+	char	*d;
+	char	*w;
+	size_t	sink;
+}	t_bench;
+
+/* run performs one call of the libft routine, or of its libc
+   counterpart when libc is set. max is the largest size timed, 0 for
+   routines whose input does not scale; libc names the counterpart, NULL
+   when libc has none. */
+typedef struct s_routine
+{
+	const char	*name;
+	size_t		(*run)(t_bench *b, size_t n, int libc);
+	size_t		max;
+	const char	*libc;
+}	t_routine;
+
+size_t	run_memcpy(t_bench *b, size_t n, int libc);
+size_t	run_memmove(t_bench *b, size_t n, int libc);
+size_t	run_memset(t_bench *b, size_t n, int libc);
+size_t	run_bzero(t_bench *b, size_t n, int libc);
+size_t	run_memchr(t_bench *b, size_t n, int libc);
+size_t	run_memcmp(t_bench *b, size_t n, int libc);
+size_t	run_calloc(t_bench *b, size_t n, int libc);
+size_t	run_strlen(t_bench *b, size_t n, int libc);
+size_t	run_strnlen(t_bench *b, size_t n, int libc);
+size_t	run_strchr(t_bench *b, size_t n, int libc);
+size_t	run_strrchr(t_bench *b, size_t n, int libc);
+size_t	run_strncmp(t_bench *b, size_t n, int libc);
+size_t	run_strlcpy(t_bench *b, size_t n, int libc);
+size_t	run_strlcat(t_bench *b, size_t n, int libc);
+size_t	run_strnstr(t_bench *b, size_t n, int libc);
+size_t	run_strdup(t_bench *b, size_t n, int libc);
+size_t	run_substr(t_bench *b, size_t n, int libc);
+size_t	run_split(t_bench *b, size_t n, int libc);
+size_t	run_atoi(t_bench *b, size_t n, int libc);
+size_t	run_itoa(t_bench *b, size_t n, int libc);
+size_t	run_strjoin(t_bench *b, size_t n, int libc);
+size_t	run_strtrim(t_bench *b, size_t n, int libc);
+size_t	run_strmapi(t_bench *b, size_t n, int libc);
+size_t	run_striteri(t_bench *b, size_t n, int libc);
+size_t	run_ctype_is(t_bench *b, size_t n, int libc);
+size_t	run_ctype_to(t_bench *b, size_t n, int libc);
+
+#endif
@@ -0,0 +1,67 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bench_run_map.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: rmourey- <rmourey-@student.42madrid.com>   +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 18:40:05 by rmourey-          #+#    #+#             */
+/*   Updated: 2026/10/18 18:40:05 by rmourey-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "bench_libft.h"
+
+static char	bench_upper(unsigned int i, char c)
+{
+	(void)i;
+	return (ft_toupper(c));
+}
+
+static void	bench_upper_at(unsigned int i, char *c)
+{
+	(void)i;
+	*c = ft_toupper(*c);
+}
+
+/* strmapi and striteri have no libc counterpart; both apply ft_toupper,
+   one into a fresh copy and one in place. */
+size_t	run_strmapi(t_bench *b, size_t n, int libc)
+{
+	char	*s;
+	size_t	c;
+
+	(void)n;
+	(void)libc;
+	s = ft_strmapi(b->s, bench_upper);
+	c = s[0];
+	free(s);
+	return (c);
+}
+
+size_t	run_striteri(t_bench *b, size_t n, int libc)
+{
+	(void)n;
+	(void)libc;
+	ft_striteri(b->d, bench_upper_at);
+	return ((size_t)b->d[0]);
+}
+
+/* Maps each of the n bytes through toupper and back through tolower. */
+size_t	run_ctype_to(t_bench *b, size_t n, int libc)
+{
+	size_t	i;
+
+	i = 0;
+	while (libc && i < n)
+	{
+		b->d[i] = tolower(toupper(b->s[i]));
+		i++;
+	}
+	while (!libc && i < n)
+	{
+		b->d[i] = ft_tolower(ft_toupper(b->s[i]));
+		i++;
+	}
+	return ((size_t)b->d[0]);
+}
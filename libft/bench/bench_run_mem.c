@@ -0,0 +1,103 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bench_run_mem.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: rmourey- <rmourey-@student.42madrid.com>   +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 16:55:01 by rmourey-          #+#    #+#             */
+/*   Updated: 2026/10/18 18:43:22 by rmourey-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "bench_libft.h"
+
+size_t	run_memcpy(t_bench *b, size_t n, int libc)
+{
+	if (libc)
+		return ((size_t)memcpy(b->d, b->s, n));
+	return ((size_t)ft_memcpy(b->d, b->s, n));
+}
+
+/* Overlapping, destination above the source: the backward copy. */
+size_t	run_memmove(t_bench *b, size_t n, int libc)
+{
+	if (libc)
+		return ((size_t)memmove(b->d + 1, b->d, n));
+	return ((size_t)ft_memmove(b->d + 1, b->d, n));
+}
+
+size_t	run_memset(t_bench *b, size_t n, int libc)
+{
+	if (libc)
+		return ((size_t)memset(b->d, 'a', n));
+	return ((size_t)ft_memset(b->d, 'a', n));
+}
+
+size_t	run_bzero(t_bench *b, size_t n, int libc)
+{
+	if (libc)
+		bzero(b->d, n);
+	else
+		ft_bzero(b->d, n);
+	return ((size_t)b->d[0]);
+}
+
+/* Searches for a byte that is absent, so the whole range is read. */
+size_t	run_memchr(t_bench *b, size_t n, int libc)
+{
+	if (libc)
+		return ((size_t)memchr(b->s, 'z', n));
+	return ((size_t)ft_memchr(b->s, 'z', n));
+}
+
+size_t	run_memcmp(t_bench *b, size_t n, int libc)
+{
+	if (libc)
+		return ((size_t)memcmp(b->s, b->d, n));
+	return ((size_t)ft_memcmp(b->s, b->d, n));
+}
+
+size_t	run_calloc(t_bench *b, size_t n, int libc)
+{
+	char	*p;
+	size_t	c;
+
+	(void)b;
+	if (libc)
+		p = calloc(n, 1);
+	else
+		p = ft_calloc(n, 1);
+	c = p[n - 1];
+	free(p);
+	return (c);
+}
+
+/* Cycles through positive, negative and zero values of every length, so
+   neither the sign branch nor the digit count is always the same. */
+size_t	run_itoa(t_bench *b, size_t n, int libc)
+{
+	static const int	values[8] = {-123456789, 42, 0, 2147483647, -7,
+		98765, -2147483648, 1000000};
+	static size_t		k;
+	char				*s;
+	size_t				c;
+
+	(void)n;
+	k++;
+	if (libc)
+		return ((size_t)snprintf(b->d, 16, "%d", values[k % 8]));
+	s = ft_itoa(values[k % 8]);
+	c = s[0];
+	free(s);
+	return (c);
+}
+
+size_t	run_atoi(t_bench *b, size_t n, int libc)
+{
+	(void)b;
+	(void)n;
+	if (libc)
+		return ((size_t)atoi("  \t-2147483647"));
+	return ((size_t)ft_atoi("  \t-2147483647"));
+}
@@ -0,0 +1,67 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bench_run_misc.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: rmourey- <rmourey-@student.42madrid.com>   +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 18:36:48 by rmourey-          #+#    #+#             */
+/*   Updated: 2026/10/18 18:36:48 by rmourey-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "bench_libft.h"
+
+/* Joins the two n-byte operands into a fresh 2n-byte string. */
+size_t	run_strjoin(t_bench *b, size_t n, int libc)
+{
+	char	*s;
+	size_t	c;
+
+	(void)n;
+	(void)libc;
+	s = ft_strjoin(b->s, b->d);
+	c = s[0];
+	free(s);
+	return (c);
+}
+
+/* The words string starts with a letter, so only its tail is trimmed and
+   most of the call is the copy of the kept range. */
+size_t	run_strtrim(t_bench *b, size_t n, int libc)
+{
+	char	*s;
+	size_t	c;
+
+	(void)n;
+	(void)libc;
+	s = ft_strtrim(b->w, " \t\n");
+	c = s[0];
+	free(s);
+	return (c);
+}
+
+/* Classifies each of the n bytes of the words string with every is*
+   routine. */
+size_t	run_ctype_is(t_bench *b, size_t n, int libc)
+{
+	size_t	c;
+	size_t	i;
+
+	c = 0;
+	i = 0;
+	while (libc && i < n)
+	{
+		c += !!isalpha(b->w[i]) + !!isdigit(b->w[i]) + !!isalnum(b->w[i])
+			+ !!isascii(b->w[i]) + !!isprint(b->w[i]);
+		i++;
+	}
+	while (!libc && i < n)
+	{
+		c += !!ft_isalpha(b->w[i]) + !!ft_isdigit(b->w[i])
+			+ !!ft_isalnum(b->w[i]) + !!ft_isascii(b->w[i])
+			+ !!ft_isprint(b->w[i]);
+		i++;
+	}
+	return (c);
+}
@@ -0,0 +1,118 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bench_run_str.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: rmourey- <rmourey-@student.42madrid.com>   +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 16:58:18 by rmourey-          #+#    #+#             */
+/*   Updated: 2026/10/18 16:58:18 by rmourey-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "bench_libft.h"
+
+size_t	run_strlen(t_bench *b, size_t n, int libc)
+{
+	(void)n;
+	if (libc)
+		return (strlen(b->s));
+	return (ft_strlen(b->s));
+}
+
+size_t	run_strnlen(t_bench *b, size_t n, int libc)
+{
+	if (libc)
+		return (strnlen(b->s, n));
+	return (ft_strnlen(b->s, n));
+}
+
+/* Absent character: the scan runs to the terminator. */
+size_t	run_strchr(t_bench *b, size_t n, int libc)
+{
+	(void)n;
+	if (libc)
+		return ((size_t)strchr(b->s, 'z'));
+	return ((size_t)ft_strchr(b->s, 'z'));
+}
+
+size_t	run_strrchr(t_bench *b, size_t n, int libc)
+{
+	(void)n;
+	if (libc)
+		return ((size_t)strrchr(b->s, 'a'));
+	return ((size_t)ft_strrchr(b->s, 'a'));
+}
+
+size_t	run_strncmp(t_bench *b, size_t n, int libc)
+{
+	if (libc)
+		return ((size_t)strncmp(b->s, b->d, n));
+	return ((size_t)ft_strncmp(b->s, b->d, n));
+}
+
+size_t	run_strlcpy(t_bench *b, size_t n, int libc)
+{
+	(void)libc;
+	return (ft_strlcpy(b->d, b->s, n + 1));
+}
+
+size_t	run_strlcat(t_bench *b, size_t n, int libc)
+{
+	(void)libc;
+	b->d[0] = '\0';
+	return (ft_strlcat(b->d, b->s, n + 1));
+}
+
+/* libc has no strnstr; strstr over the same string is the reference. */
+size_t	run_strnstr(t_bench *b, size_t n, int libc)
+{
+	if (libc)
+		return ((size_t)strstr(b->s, "az"));
+	return ((size_t)ft_strnstr(b->s, "az", n));
+}
+
+size_t	run_strdup(t_bench *b, size_t n, int libc)
+{
+	char	*s;
+	size_t	c;
+
+	(void)n;
+	if (libc)
+		s = strdup(b->s);
+	else
+		s = ft_strdup(b->s);
+	c = s[0];
+	free(s);
+	return (c);
+}
+
+/* The middle half of the string; strndup is the closest libc call. */
+size_t	run_substr(t_bench *b, size_t n, int libc)
+{
+	char	*s;
+	size_t	c;
+
+	if (libc)
+		s = strndup(b->s + n / 4, n / 2);
+	else
+		s = ft_substr(b->s, n / 4, n / 2);
+	c = s[0];
+	free(s);
+	return (c);
+}
+
+size_t	run_split(t_bench *b, size_t n, int libc)
+{
+	char	**words;
+	size_t	i;
+
+	(void)n;
+	(void)libc;
+	words = ft_split(b->w, ' ');
+	i = 0;
+	while (words && words[i])
+		free(words[i++]);
+	free(words);
+	return (i);
+}
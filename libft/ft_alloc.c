@@ -0,0 +1,91 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_alloc.c                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: rmourey- <rmourey-@student.42madrid.com>   +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 17:01:35 by rmourey-          #+#    #+#             */
+/*   Updated: 2026/10/18 17:01:35 by rmourey-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "libft.h"
+#include <malloc.h>
+
+static t_alloc_stats	g_alloc;
+
+/* Counts go to the outermost tracked libft call on this thread, so the
+   words of ft_split show up under ft_split, not ft_substr. Live bytes use
+   the usable size of the block, which is also what ft_free subtracts. */
+static void	ft_alloc_note(void *p, size_t n, t_alloc_fn fn)
+{
+	t_alloc_count	*count;
+	long long		live;
+	long long		peak;
+
+	count = &g_alloc.fn[ft_alloc_owner(fn)];
+	if (!p)
+	{
+		__atomic_fetch_add(&count->failed, 1, __ATOMIC_RELAXED);
+		return ;
+	}
+	__atomic_fetch_add(&count->allocs, 1, __ATOMIC_RELAXED);
+	__atomic_fetch_add(&count->bytes, n, __ATOMIC_RELAXED);
+	live = __atomic_add_fetch(&g_alloc.live, malloc_usable_size(p),
+			__ATOMIC_RELAXED);
+	peak = __atomic_load_n(&g_alloc.peak, __ATOMIC_RELAXED);
+	while (live > peak && !__atomic_compare_exchange_n(&g_alloc.peak, &peak,
+			live, 1, __ATOMIC_RELAXED, __ATOMIC_RELAXED))
+		;
+}
+
+/* malloc for the allocating libft functions; fn names the caller. */
+void	*ft_alloc(size_t n, t_alloc_fn fn)
+{
+	void	*p;
+
+	p = malloc(n);
+	if (FT_ALLOC_TRACK)
+		ft_alloc_note(p, n, fn);
+	return (p);
+}
+
+/* free that keeps the live byte count right. Memory from ft_alloc should
+   be released here; a block freed with free stays live in the stats. */
+void	ft_free(void *p)
+{
+	if (FT_ALLOC_TRACK && p)
+		__atomic_sub_fetch(&g_alloc.live, malloc_usable_size(p),
+			__ATOMIC_RELAXED);
+	free(p);
+}
+
+/* All zero when libft is built without FT_ALLOC_TRACK. */
+void	ft_alloc_stats(t_alloc_stats *stats)
+{
+	t_alloc_count	*c;
+	int				k;
+
+	k = -1;
+	while (++k < ALLOC_FNS)
+	{
+		c = &g_alloc.fn[k];
+		stats->fn[k].allocs = __atomic_load_n(&c->allocs, __ATOMIC_RELAXED);
+		stats->fn[k].bytes = __atomic_load_n(&c->bytes, __ATOMIC_RELAXED);
+		stats->fn[k].failed = __atomic_load_n(&c->failed, __ATOMIC_RELAXED);
+	}
+	stats->live = __atomic_load_n(&g_alloc.live, __ATOMIC_RELAXED);
+	stats->peak = __atomic_load_n(&g_alloc.peak, __ATOMIC_RELAXED);
+}
+
+/* Clears the counters and restarts the high-water mark from the current
+   live bytes. Not synchronised with allocating threads. */
+void	ft_alloc_stats_reset(void)
+{
+	long long	live;
+
+	live = __atomic_load_n(&g_alloc.live, __ATOMIC_RELAXED);
+	ft_bzero(g_alloc.fn, sizeof(g_alloc.fn));
+	__atomic_store_n(&g_alloc.peak, live, __ATOMIC_RELAXED);
+}
@@ -0,0 +1,53 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_alloc_owner.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: rmourey- <rmourey-@student.42madrid.com>   +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 17:04:52 by rmourey-          #+#    #+#             */
+/*   Updated: 2026/10/18 17:04:52 by rmourey-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "libft.h"
+
+static const char *const	g_alloc_names[ALLOC_FNS] = {"none",
+	"ft_calloc", "ft_strdup", "ft_substr", "ft_strjoin", "ft_strtrim",
+	"ft_split", "ft_itoa", "ft_strmapi", "ft_lstnew", "ft_lstmap"};
+
+static __thread t_alloc_fn	g_alloc_owner;
+
+/* Marks the start of a call that allocates through other libft
+   functions. Returns the previous owner, for ft_alloc_leave. */
+t_alloc_fn	ft_alloc_enter(t_alloc_fn fn)
+{
+	t_alloc_fn	prev;
+
+	if (!FT_ALLOC_TRACK)
+		return (ALLOC_NONE);
+	prev = g_alloc_owner;
+	if (prev == ALLOC_NONE)
+		g_alloc_owner = fn;
+	return (prev);
+}
+
+void	ft_alloc_leave(t_alloc_fn prev)
+{
+	if (FT_ALLOC_TRACK)
+		g_alloc_owner = prev;
+}
+
+t_alloc_fn	ft_alloc_owner(t_alloc_fn fn)
+{
+	if (g_alloc_owner != ALLOC_NONE)
+		return (g_alloc_owner);
+	return (fn);
+}
+
+const char	*ft_alloc_name(t_alloc_fn fn)
+{
+	if ((unsigned int)fn >= ALLOC_FNS)
+		return ("unknown");
+	return (g_alloc_names[fn]);
+}
@@ -6,7 +6,7 @@
 /*   By: rmourey- <rmourey-@student.42madrid.com>   +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2026/01/16 13:14:21 by rmourey-          #+#    #+#             */
-/*   Updated: 2026/01/16 13:14:21 by rmourey-         ###   ########.fr       */
+/*   Updated: 2026/10/18 17:11:26 by rmourey-         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -20,7 +20,7 @@ void	*ft_calloc(size_t count, size_t size)
 	if (size != 0 && count > (size_t)-1 / size)
 		return (NULL);
 	total = count * size;
-	ptr = malloc(total);
+	ptr = ft_alloc(total, ALLOC_CALLOC);
 	if (!ptr)
 		return (NULL);
 	ft_bzero(ptr, count * size);
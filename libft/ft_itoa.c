@@ -6,25 +6,17 @@
 /*   By: rmourey- <rmourey-@student.42madrid.com>   +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2026/01/19 15:00:00 by rmourey-          #+#    #+#             */
-/*   Updated: 2026/01/26 11:45:07 by rmourey-         ###   ########.fr       */
+/*   Updated: 2026/10/18 18:53:13 by rmourey-         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #include "libft.h"
 
-static int	get_len(int n)
+static int	get_len(long n)
 {
-	int	len;
-
-	len = 0;
-	if (n <= 0)
-		len = 1;
-	while (n != 0)
-	{
-		n /= 10;
-		len++;
-	}
-	return (len);
+	if (n < 0)
+		return (1 + ft_declen(-n));
+	return (ft_declen(n));
 }
 
 char	*ft_itoa(int n)
@@ -35,12 +27,15 @@ char	*ft_itoa(int n)
 
 	num = n;
 	len = get_len(num);
-	str = (char *)malloc((len + 1) * sizeof(char *));
+	str = ft_alloc(len + 1, ALLOC_ITOA);
 	if (!str)
 		return (NULL);
+	str[len] = '\0';
 	if (num < 0)
+	{
 		str[0] = '-';
-	num = -num;
+		num = -num;
+	}
 	if (num == 0)
 		str[0] = '0';
 	while (num > 0)
@@ -6,20 +6,18 @@
 /*   By: rmourey- <rmourey-@student.42madrid.com>   +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2026/01/19 16:30:00 by rmourey-          #+#    #+#             */
-/*   Updated: 2026/01/19 16:30:00 by rmourey-         ###   ########.fr       */
+/*   Updated: 2026/10/18 17:44:16 by rmourey-         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #include "libft.h"
 
-t_list	*ft_lstmap(t_list *lst, void *(*f)(void *), void (*del)(void *))
+static t_list	*map_nodes(t_list *lst, void *(*f)(void *), void (*del)(void *))
 {
 	t_list	*new_list;
 	t_list	*new_node;
 	void	*content;
 
-	if (!lst || !f || !del)
-		return (NULL);
 	new_list = NULL;
 	while (lst)
 	{
@@ -36,3 +34,16 @@ t_list	*ft_lstmap(t_list *lst, void *(*f)(void *), void (*del)(void *))
 	}
 	return (new_list);
 }
+
+t_list	*ft_lstmap(t_list *lst, void *(*f)(void *), void (*del)(void *))
+{
+	t_list		*new_list;
+	t_alloc_fn	prev;
+
+	if (!lst || !f || !del)
+		return (NULL);
+	prev = ft_alloc_enter(ALLOC_LSTMAP);
+	new_list = map_nodes(lst, f, del);
+	ft_alloc_leave(prev);
+	return (new_list);
+}
@@ -6,7 +6,7 @@
 /*   By: rmourey- <rmourey-@student.42madrid.com>   +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2026/01/19 16:30:00 by rmourey-          #+#    #+#             */
-/*   Updated: 2026/01/19 16:30:00 by rmourey-         ###   ########.fr       */
+/*   Updated: 2026/10/18 17:34:25 by rmourey-         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -16,7 +16,7 @@ t_list	*ft_lstnew(void *content)
 {
 	t_list	*node;
 
-	node = malloc(sizeof(t_list));
+	node = ft_alloc(sizeof(t_list), ALLOC_LSTNEW);
 	if (!node)
 		return (NULL);
 	node->content = content;
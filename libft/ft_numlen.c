@@ -0,0 +1,37 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_numlen.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: rmourey- <rmourey-@student.42madrid.com>   +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 09:15:21 by rmourey-          #+#    #+#             */
+/*   Updated: 2026/10/18 09:15:21 by rmourey-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "libft.h"
+
+int	ft_bitlen(unsigned long long n)
+{
+	return (64 - __builtin_clzll(n | 1));
+}
+
+int	ft_declen(unsigned long long n)
+{
+	static const unsigned long long	pow10[20] = {1ULL, 10ULL, 100ULL,
+		1000ULL, 10000ULL, 100000ULL, 1000000ULL, 10000000ULL,
+		100000000ULL, 1000000000ULL, 10000000000ULL, 100000000000ULL,
+		1000000000000ULL, 10000000000000ULL, 100000000000000ULL,
+		1000000000000000ULL, 10000000000000000ULL, 100000000000000000ULL,
+		1000000000000000000ULL, 10000000000000000000ULL};
+	int								t;
+
+	t = (ft_bitlen(n) * 1233) >> 12;
+	return (t + ((n | 1) >= pow10[t]));
+}
+
+int	ft_pow2len(unsigned long long n, int shift)
+{
+	return ((ft_bitlen(n) + shift - 1) / shift);
+}
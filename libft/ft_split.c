@@ -6,7 +6,7 @@
 /*   By: rmourey- <rmourey-@student.42madrid.com>   +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2026/01/16 18:24:47 by rmourey-          #+#    #+#             */
-/*   Updated: 2026/01/19 14:44:20 by rmourey-         ###   ########.fr       */
+/*   Updated: 2026/10/18 17:40:59 by rmourey-         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -38,8 +38,8 @@ static int	count_words(char const *s, char c)
 static void	free_all(char **arr, size_t count)
 {
 	while (count--)
-		free(arr[count]);
-	free(arr);
+		ft_free(arr[count]);
+	ft_free(arr);
 }
 
 static int	fill_result(char **result, char const *s, char c)
@@ -71,14 +71,15 @@ static int	fill_result(char **result, char const *s, char c)
 
 char	**ft_split(char const *s, char c)
 {
-	char	**result;
+	char		**result;
+	t_alloc_fn	prev;
 
 	if (!s)
 		return (NULL);
-	result = malloc((count_words(s, c) + 1) * sizeof(char *));
-	if (!result)
-		return (NULL);
-	if (!fill_result(result, s, c))
-		return (NULL);
+	prev = ft_alloc_enter(ALLOC_SPLIT);
+	result = ft_alloc((count_words(s, c) + 1) * sizeof(char *), ALLOC_SPLIT);
+	if (result && !fill_result(result, s, c))
+		result = NULL;
+	ft_alloc_leave(prev);
 	return (result);
 }
@@ -6,7 +6,7 @@
 /*   By: rmourey- <rmourey-@student.42madrid.com>   +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2026/01/16 13:12:51 by rmourey-          #+#    #+#             */
-/*   Updated: 2026/01/16 13:12:51 by rmourey-         ###   ########.fr       */
+/*   Updated: 2026/10/18 17:14:43 by rmourey-         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -18,7 +18,7 @@ char	*ft_strdup(const char *s)
 	size_t	len;
 
 	len = ft_strlen(s) + 1;
-	copy = malloc(len);
+	copy = ft_alloc(len, ALLOC_STRDUP);
 	if (!copy)
 		return (NULL);
 	ft_memcpy(copy, s, len);
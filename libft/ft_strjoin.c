@@ -6,7 +6,7 @@
 /*   By: rmourey- <rmourey-@student.42madrid.com>   +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2026/01/16 15:37:23 by rmourey-          #+#    #+#             */
-/*   Updated: 2026/01/16 15:37:23 by rmourey-         ###   ########.fr       */
+/*   Updated: 2026/10/18 17:21:17 by rmourey-         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -20,7 +20,7 @@ char	*ft_strjoin(char const *s1, char const *s2)
 
 	if (!s1 || !s2)
 		return (NULL);
-	result = (char *)malloc((ft_strlen(s1) + ft_strlen(s2) + 1) * sizeof(char));
+	result = ft_alloc(ft_strlen(s1) + ft_strlen(s2) + 1, ALLOC_STRJOIN);
 	if (!result)
 		return (NULL);
 	i = -1;
@@ -6,7 +6,7 @@
 /*   By: rmourey- <rmourey-@student.42madrid.com>   +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2026/01/19 15:40:00 by rmourey-          #+#    #+#             */
-/*   Updated: 2026/01/19 15:40:00 by rmourey-         ###   ########.fr       */
+/*   Updated: 2026/10/18 17:31:08 by rmourey-         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -19,7 +19,7 @@ char	*ft_strmapi(char const *s, char (*f)(unsigned int, char))
 
 	if (!s || !f)
 		return (NULL);
-	result = malloc(ft_strlen(s) + 1);
+	result = ft_alloc(ft_strlen(s) + 1, ALLOC_STRMAPI);
 	if (!result)
 		return (NULL);
 	i = 0;
@@ -0,0 +1,60 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_strnlen.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: rmourey- <rmourey-@student.42madrid.com>   +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 13:05:11 by rmourey-          #+#    #+#             */
+/*   Updated: 2026/10/18 17:54:07 by rmourey-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "libft.h"
+#include <stdint.h>
+
+#if FT_SSE2_SCAN
+# include <emmintrin.h>
+
+/* Aligned 16-byte loads never cross a page, so the scan may look past
+   maxlen inside the current block but never faults. */
+size_t	ft_strnlen(const char *s, size_t maxlen)
+{
+	size_t	i;
+	int		mask;
+
+	i = 0;
+	while (i < maxlen && ((uintptr_t)(s + i) & 15))
+	{
+		if (!s[i])
+			return (i);
+		i++;
+	}
+	while (i < maxlen)
+	{
+		mask = _mm_movemask_epi8(_mm_cmpeq_epi8(
+					_mm_load_si128((const __m128i *)(s + i)),
+					_mm_setzero_si128()));
+		if (mask)
+		{
+			i += __builtin_ctz(mask);
+			break ;
+		}
+		i += 16;
+	}
+	if (i > maxlen)
+		return (maxlen);
+	return (i);
+}
+#else
+
+size_t	ft_strnlen(const char *s, size_t maxlen)
+{
+	size_t	i;
+
+	i = 0;
+	while (i < maxlen && s[i])
+		i++;
+	return (i);
+}
+#endif
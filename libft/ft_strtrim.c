@@ -6,7 +6,7 @@
 /*   By: rmourey- <rmourey-@student.42madrid.com>   +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2026/01/16 16:26:34 by rmourey-          #+#    #+#             */
-/*   Updated: 2026/01/16 16:26:34 by rmourey-         ###   ########.fr       */
+/*   Updated: 2026/10/18 17:24:34 by rmourey-         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -27,9 +27,7 @@ char	*ft_strtrim(char const *s1, char const *set)
 	end = ft_strlen(s1);
 	while (end > start && ft_strchr(set, s1[end - 1]))
 		end--;
-	if (start >= end)
-		return (ft_strdup(""));
-	result = (char *)malloc((end - start + 1) * sizeof(char));
+	result = ft_alloc(end - start + 1, ALLOC_STRTRIM);
 	if (!result)
 		return (NULL);
 	i = 0;
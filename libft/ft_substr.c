@@ -6,7 +6,7 @@
 /*   By: rmourey- <rmourey-@student.42madrid.com>   +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2026/01/16 13:16:11 by rmourey-          #+#    #+#             */
-/*   Updated: 2026/01/16 13:16:11 by rmourey-         ###   ########.fr       */
+/*   Updated: 2026/10/18 17:18:00 by rmourey-         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -25,7 +25,7 @@ char	*ft_substr(char const *s, unsigned int start, size_t len)
 		len = 0;
 	else if (len > slen - start)
 		len = slen - start;
-	ptr = (char *)malloc((len + 1) * sizeof(char));
+	ptr = ft_alloc(len + 1, ALLOC_SUBSTR);
 	if (!ptr)
 		return (NULL);
 	i = 0;
@@ -6,7 +6,7 @@
 /*   By: rmourey- <rmourey-@student.42madrid.com>   +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2026/01/16 13:11:59 by rmourey-          #+#    #+#             */
-/*   Updated: 2026/01/16 13:11:59 by rmourey-         ###   ########.fr       */
+/*   Updated: 2026/10/18 17:50:50 by rmourey-         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -16,6 +16,56 @@
 # include <stdlib.h>
 # include <unistd.h>
 
+/* The SSE2 scans load whole aligned blocks and may read past the end of
+   the string; sanitizer builds use the scalar loops instead. */
+# ifdef __has_feature
+#  if __has_feature(address_sanitizer)
+#   define FT_ASAN 1
+#  endif
+# endif
+# ifdef __SANITIZE_ADDRESS__
+#  define FT_ASAN 1
+# endif
+# if defined(__SSE2__) && !defined(FT_ASAN)
+#  define FT_SSE2_SCAN 1
+# else
+#  define FT_SSE2_SCAN 0
+# endif
+
+# ifndef FT_ALLOC_TRACK
+#  define FT_ALLOC_TRACK 0
+# endif
+
+typedef enum e_alloc_fn
+{
+	ALLOC_NONE,
+	ALLOC_CALLOC,
+	ALLOC_STRDUP,
+	ALLOC_SUBSTR,
+	ALLOC_STRJOIN,
+	ALLOC_STRTRIM,
+	ALLOC_SPLIT,
+	ALLOC_ITOA,
+	ALLOC_STRMAPI,
+	ALLOC_LSTNEW,
+	ALLOC_LSTMAP,
+	ALLOC_FNS
+}	t_alloc_fn;
+
+typedef struct s_alloc_count
+{
+	unsigned long long	allocs;
+	unsigned long long	bytes;
+	unsigned long long	failed;
+}	t_alloc_count;
+
+typedef struct s_alloc_stats
+{
+	t_alloc_count	fn[ALLOC_FNS];
+	long long		live;
+	long long		peak;
+}	t_alloc_stats;
+
 typedef struct s_list
 {
 	void			*content;
@@ -30,6 +80,7 @@ int		ft_isprint(int c);
 int		ft_toupper(int c);
 int		ft_tolower(int c);
 size_t	ft_strlen(const char *c);
+size_t	ft_strnlen(const char *s, size_t maxlen);
 void	*ft_memset(void *s, int c, size_t n);
 void	ft_bzero(void *s, size_t n);
 void	*ft_memcpy(void *dest, const void *src, size_t n);
@@ -50,6 +101,9 @@ char	*ft_strjoin(char const *s1, char const *s2);
 char	*ft_strtrim(char const *s1, char const *set);
 char	**ft_split(char const *s, char c);
 char	*ft_itoa(int n);
+int		ft_bitlen(unsigned long long n);
+int		ft_declen(unsigned long long n);
+int		ft_pow2len(unsigned long long n, int shift);
 char	*ft_strmapi(char const *s, char (*f)(unsigned int, char));
 void	ft_striteri(char *s, void (*f)(unsigned int, char*));
 void	ft_putchar_fd(char c, int fd);
@@ -65,4 +119,12 @@ void	ft_lstdelone(t_list *lst, void (*del)(void *));
 void	ft_lstclear(t_list **lst, void (*del)(void *));
 void	ft_lstiter(t_list *lst, void (*f)(void *));
 t_list	*ft_lstmap(t_list *lst, void *(*f)(void *), void (*del)(void *));
+void	*ft_alloc(size_t n, t_alloc_fn fn);
+void	ft_free(void *p);
+void	ft_alloc_stats(t_alloc_stats *stats);
+void	ft_alloc_stats_reset(void);
+const char	*ft_alloc_name(t_alloc_fn fn);
+t_alloc_fn	ft_alloc_enter(t_alloc_fn fn);
+void	ft_alloc_leave(t_alloc_fn prev);
+t_alloc_fn	ft_alloc_owner(t_alloc_fn fn);
 #endif
@@ -0,0 +1,84 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_printf_decode.c                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: rmourey- <rmourey-@student.42madrid.com>   +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 15:42:47 by rmourey-          #+#    #+#             */
+/*   Updated: 2026/10/18 15:42:47 by rmourey-         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../ft_printf_bonus.h"
+#include <fcntl.h>
+#include <stdlib.h>
+
+#define DECODE_CHUNK 65536
+
+static unsigned char	*decode_grow(unsigned char *buf, size_t len,
+							size_t *cap)
+{
+	unsigned char	*grown;
+
+	*cap *= 2;
+	grown = malloc(*cap);
+	if (grown)
+		ft_memcpy(grown, buf, len);
+	free(buf);
+	return (grown);
+}
+
+/* Reads the whole log: records can reference formats defined anywhere
+   earlier in the stream. */
+static unsigned char	*decode_read(int fd, size_t *len)
+{
+	unsigned char	*buf;
+	size_t			cap;
+	ssize_t			r;
+
+	cap = DECODE_CHUNK;
+	buf = malloc(cap);
+	*len = 0;
+	r = 1;
+	while (buf && r > 0)
+	{
+		if (*len == cap)
+			buf = decode_grow(buf, *len, &cap);
+		if (!buf)
+			break ;
+		r = read(fd, buf + *len, cap - *len);
+		if (r > 0)
+			*len += r;
+	}
+	if (r < 0)
+	{
+		free(buf);
+		return (NULL);
+	}
+	return (buf);
+}
+
+/* usage: ft_printf_decode [log]; reads stdin without an argument. */
+int	main(int argc, char **argv)
+{
+	unsigned char	*data;
+	size_t			len;
+	int				fd;
+	t_sink			out;
+
+	fd = 0;
+	if (argc > 1)
+		fd = open(argv[1], O_RDONLY);
+	if (fd < 0)
+		return (1);
+	data = decode_read(fd, &len);
+	if (!data)
+		return (1);
+	ft_sink_fd(&out, 1);
+	ft_blog_decode(&out, data, len);
+	free(data);
+	if (ft_sink_flush(&out) < 0)
+		return (1);
+	return (0);
+}